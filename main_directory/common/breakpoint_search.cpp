@@ -0,0 +1,181 @@
+#include "breakpoint_search.h"
+#include "list_scheduler.h"
+#include "machine_load_tracker.h"
+#include "makespan_bounds.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+using namespace std;
+
+class BreakpointSearch {
+public:
+    BreakpointSearch(const vector<int>& tasks, int numMachines, int numBreakpoints, int gridPercent,
+                     const BreakpointResult& incumbent, double timeBudget)
+        : tasks(tasks), timeBudget(timeBudget), done(false), result(incumbent) {
+        int numJobs = static_cast<int>(tasks.size());
+        boundaries.push_back(0);
+        for (int percentage = gridPercent; percentage < 100; percentage += gridPercent) {
+            int position = PercentageSplit{percentage}(numJobs);
+            if (position > boundaries.back() && position < numJobs) {
+                boundaries.push_back(position);
+            }
+        }
+        boundaries.push_back(numJobs);
+        int numBoundaries = static_cast<int>(boundaries.size());
+        breakpointCount = min(numBreakpoints, numBoundaries - 2);
+
+        sortedPositions.resize(numJobs);
+        iota(sortedPositions.begin(), sortedPositions.end(), 0);
+        stable_sort(sortedPositions.begin(), sortedPositions.end(),
+                    [&](int a, int b) { return tasks[a] < tasks[b]; });
+
+        // Longest job still to come after each boundary.
+        suffixMax.assign(numBoundaries, 0);
+        for (int b = numBoundaries - 2; b >= 0; --b) {
+            suffixMax[b] = suffixMax[b + 1];
+            for (int j = boundaries[b]; j < boundaries[b + 1]; ++j) {
+                suffixMax[b] = max(suffixMax[b], tasks[j]);
+            }
+        }
+
+        segments.resize(numBoundaries * numBoundaries);
+        built.assign(numBoundaries * numBoundaries, false);
+        levels.assign(breakpointCount + 2, MachineLoadTracker(numMachines));
+        levelMax.assign(breakpointCount + 2, 0);
+        chosen.assign(breakpointCount + 1, 0);
+        orders.assign(breakpointCount + 1, TaskOrder::Descending);
+
+        result.segmentsScheduled = 0;
+        result.sequencesTried.assign(breakpointCount + 1, 0);
+        result.complete = true;
+        lowerBound = makespanLowerBound(tasks, numMachines);
+        done = result.Cmax <= lowerBound;
+    }
+
+    BreakpointResult run() {
+        start = chrono::steady_clock::now();
+        // Fewer breakpoints first: each family that improves on the
+        // incumbent tightens the pruning of the deeper ones.
+        for (int depthLimit = 0; depthLimit <= breakpointCount && !done; ++depthLimit) {
+            search(0, 0, depthLimit);
+        }
+        return result;
+    }
+
+private:
+    // Durations of the input tasks between two boundaries, ascending; built
+    // on first use and shared by every sequence that has this segment.
+    const vector<int>& segment(int first, int last) {
+        int key = first * static_cast<int>(boundaries.size()) + last;
+        if (!built[key]) {
+            for (int position : sortedPositions) {
+                if (position >= boundaries[first] && position < boundaries[last]) {
+                    segments[key].push_back(tasks[position]);
+                }
+            }
+            built[key] = true;
+        }
+        return segments[key];
+    }
+
+    // Schedules the segment on top of the state at depth into depth + 1.
+    // False as soon as the sequence can no longer beat the best one: every
+    // job still to come lands on a machine at least as loaded as the
+    // lightest one now, so the longest of them bounds Cmax from below.
+    bool schedule(int depth, int first, int last, TaskOrder order) {
+        if (chrono::duration<double>(chrono::steady_clock::now() - start).count() > timeBudget) {
+            result.complete = false;
+            done = true;
+            return false;
+        }
+        const vector<int>& durations = segment(first, last);
+        MachineLoadTracker& machines = levels[depth + 1];
+        machines = levels[depth];
+        int runningMax = levelMax[depth];
+        result.segmentsScheduled++;
+        if (last == static_cast<int>(boundaries.size()) - 1) {
+            result.sequencesTried[depth]++;
+        }
+
+        int count = static_cast<int>(durations.size());
+        int laterMax = max(suffixMax[last], order == TaskOrder::Ascending ? durations.back() : 0);
+        for (int i = 0; i < count; ++i) {
+            int duration = durations[order == TaskOrder::Ascending ? i : count - 1 - i];
+            int machine = machines.leastLoaded();
+            if (static_cast<long long>(machines.load(machine)) + max(duration, laterMax) >= result.Cmax) {
+                return false;
+            }
+            machines.assign(machine, duration);
+            runningMax = max(runningMax, machines.load(machine));
+            if (runningMax >= result.Cmax) {
+                return false;
+            }
+        }
+        levelMax[depth + 1] = runningMax;
+        return true;
+    }
+
+    // Completes the prefix of depth segments ending at first with exactly
+    // depthLimit + 1 segments.
+    void search(int depth, int first, int depthLimit) {
+        int lastBoundary = static_cast<int>(boundaries.size()) - 1;
+        if (depth == depthLimit) {
+            for (TaskOrder order : {TaskOrder::Descending, TaskOrder::Ascending}) {
+                if (!done && schedule(depth, first, lastBoundary, order)) {
+                    chosen[depth] = lastBoundary;
+                    orders[depth] = order;
+                    record(depth);
+                }
+            }
+            return;
+        }
+
+        int lastChoice = lastBoundary - (depthLimit - depth);
+        for (int last = first + 1; last <= lastChoice && !done; ++last) {
+            for (TaskOrder order : {TaskOrder::Descending, TaskOrder::Ascending}) {
+                if (!done && schedule(depth, first, last, order)) {
+                    chosen[depth] = last;
+                    orders[depth] = order;
+                    search(depth + 1, last, depthLimit);
+                }
+            }
+        }
+    }
+
+    void record(int depth) {
+        result.Cmax = levelMax[depth + 1];
+        result.breakpoints.clear();
+        for (int segment = 0; segment < depth; ++segment) {
+            result.breakpoints.push_back(boundaries[chosen[segment]]);
+        }
+        result.segmentOrders.assign(orders.begin(), orders.begin() + depth + 1);
+        done = result.Cmax <= lowerBound;
+    }
+
+    const vector<int>& tasks;
+    int breakpointCount;
+    long long lowerBound;
+    double timeBudget;
+    chrono::steady_clock::time_point start;
+    bool done;
+
+    vector<int> boundaries;
+    vector<int> sortedPositions;
+    vector<int> suffixMax;
+    vector<vector<int>> segments;
+    vector<bool> built;
+
+    vector<MachineLoadTracker> levels;
+    vector<int> levelMax;
+    vector<int> chosen;
+    vector<TaskOrder> orders;
+    BreakpointResult result;
+};
+
+BreakpointResult searchBreakpoints(const vector<int>& tasks, int numMachines, int numBreakpoints, int gridPercent,
+                                   const BreakpointResult& incumbent, double timeBudget) {
+    if (tasks.empty() || numMachines <= 0) {
+        return {0, {}, {}, 0, {}, true};
+    }
+    return BreakpointSearch(tasks, numMachines, numBreakpoints, gridPercent, incumbent, timeBudget).run();
+}
@@ -0,0 +1,39 @@
+#ifndef BREAKPOINT_SEARCH_H
+#define BREAKPOINT_SEARCH_H
+
+#include "task_ordering.h"
+#include <vector>
+
+struct BreakpointResult {
+    long long Cmax;
+    // Input positions b1 < ... < bk (at most numBreakpoints of them); segment
+    // s holds the input tasks between consecutive breakpoints (0 and n at the
+    // ends).
+    std::vector<int> breakpoints;
+    // How each segment is sorted before it is listed.
+    std::vector<TaskOrder> segmentOrders;
+    // Segment schedules performed.
+    long long segmentsScheduled;
+    // Sequences whose last segment was reached, by breakpoint count.
+    std::vector<long long> sequencesTried;
+    // False if the time budget ran out before the search finished.
+    bool complete;
+};
+
+// Generalizes the SPT -> LPT split to up to numBreakpoints breakpoints, each
+// segment ascending or descending, and list schedules the concatenated
+// segments. Breakpoints are drawn from the percentage grid
+// round(p / 100 * n), p = gridPercent, 2 * gridPercent, ... < 100, so the
+// family contains LPT, SPT and every percentage split. The search starts from
+// incumbent (typically the best percentage split) and only replaces it with a
+// strictly better sequence. Families are searched by increasing breakpoint
+// count, each depth-first over segments: the machine state after a prefix of
+// segments is built once and shared by every completion of that prefix, and
+// a segment is abandoned as soon as its lightest machine plus the longest job
+// still to come reaches the best Cmax. The search stops when
+// makespanLowerBound() is met or after timeBudget seconds, whichever comes
+// first.
+BreakpointResult searchBreakpoints(const std::vector<int>& tasks, int numMachines, int numBreakpoints,
+                                   int gridPercent, const BreakpointResult& incumbent, double timeBudget);
+
+#endif
@@ -0,0 +1,395 @@
+#include "dual_approximation.h"
+#include "list_schedule.h"
+#include "makespan_bounds.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+using namespace std;
+
+// Maps a vector of job counts to a machine count. Every count gets just enough
+// bits for its maximum, fields never straddle a word, and the packed words of
+// all entries sit in one flat array probed linearly.
+class PackedStateTable {
+public:
+    explicit PackedStateTable(const vector<int>& maxCounts) : wordCount(1), entries(0) {
+        int used = 0;
+        for (int maxCount : maxCounts) {
+            int bits = 1;
+            while ((1LL << bits) <= maxCount) {
+                bits++;
+            }
+            if (used + bits > 64) {
+                wordCount++;
+                used = 0;
+            }
+            fieldWord.push_back(wordCount - 1);
+            fieldShift.push_back(used);
+            used += bits;
+        }
+        resize(1024);
+    }
+
+    void pack(const vector<int>& counts, vector<uint64_t>& key) const {
+        key.assign(wordCount, 0);
+        for (size_t i = 0; i < counts.size(); ++i) {
+            key[fieldWord[i]] |= static_cast<uint64_t>(counts[i]) << fieldShift[i];
+        }
+    }
+
+    // Stored value for key, or -1.
+    int find(const vector<uint64_t>& key) const {
+        for (size_t slot = hash(key) & mask;; slot = (slot + 1) & mask) {
+            if (values[slot] < 0) {
+                return -1;
+            }
+            if (equal(key.begin(), key.end(), keys.begin() + slot * wordCount)) {
+                return values[slot];
+            }
+        }
+    }
+
+    // Inserts key, or overwrites its value when it is already present.
+    void store(const vector<uint64_t>& key, int value) {
+        if (2 * (entries + 1) > values.size()) {
+            resize(2 * values.size());
+        }
+        size_t slot = hash(key) & mask;
+        while (values[slot] >= 0) {
+            if (equal(key.begin(), key.end(), keys.begin() + slot * wordCount)) {
+                values[slot] = value;
+                return;
+            }
+            slot = (slot + 1) & mask;
+        }
+        copy(key.begin(), key.end(), keys.begin() + slot * wordCount);
+        values[slot] = value;
+        entries++;
+    }
+
+    size_t size() const { return entries; }
+
+private:
+    size_t hash(const vector<uint64_t>& key) const {
+        uint64_t h = 0x9E3779B97F4A7C15ULL;
+        for (uint64_t word : key) {
+            h ^= word + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+            h *= 0xBF58476D1CE4E5B9ULL;
+        }
+        return static_cast<size_t>(h ^ (h >> 31));
+    }
+
+    void resize(size_t capacity) {
+        vector<uint64_t> oldKeys = move(keys);
+        vector<int> oldValues = move(values);
+
+        keys.assign(capacity * wordCount, 0);
+        values.assign(capacity, -1);
+        mask = capacity - 1;
+        entries = 0;
+
+        vector<uint64_t> key(wordCount);
+        for (size_t slot = 0; slot < oldValues.size(); ++slot) {
+            if (oldValues[slot] >= 0) {
+                copy(oldKeys.begin() + slot * wordCount, oldKeys.begin() + (slot + 1) * wordCount, key.begin());
+                store(key, oldValues[slot]);
+            }
+        }
+    }
+
+    int wordCount;
+    vector<int> fieldWord;
+    vector<int> fieldShift;
+    vector<uint64_t> keys;
+    vector<int> values;
+    size_t mask;
+    size_t entries;
+};
+
+// Decides whether a number of machines of capacity K hold a multiset of
+// rounded job sizes. A depth-first search places the largest remaining job
+// with a maximal configuration (no remaining job fits in what is left), which
+// loses no packing: any job that would still fit can be moved there from
+// another machine. The table keeps, for every state that failed, the fewest
+// machines it might still need.
+class ConfigurationDP {
+public:
+    ConfigurationDP(const vector<int>& sizes, const vector<int>& counts, int capacity)
+        : sizes(sizes), capacity(capacity), table(counts), exhausted(false) {
+        vector<int> config(sizes.size(), 0);
+        enumerate(0, capacity, counts, config);
+        sort(configs.begin(), configs.end(), [&](const vector<int>& a, const vector<int>& b) {
+            return units(a) > units(b);
+        });
+        withClass.resize(sizes.size());
+        for (size_t index = 0; index < configs.size(); ++index) {
+            for (size_t cls = 0; cls < sizes.size(); ++cls) {
+                if (configs[index][cls] > 0) {
+                    withClass[cls].push_back(static_cast<int>(index));
+                    break;
+                }
+            }
+        }
+    }
+
+    // True when numMachines machines hold counts; packing() then has one
+    // configuration per machine used.
+    bool fits(vector<int>& counts, int numMachines) {
+        chosen.clear();
+        return search(counts, numMachines);
+    }
+
+    vector<vector<int>> packing() const {
+        vector<vector<int>> machines;
+        for (int index : chosen) {
+            machines.push_back(configs[index]);
+        }
+        return machines;
+    }
+
+    bool outgrown() const { return exhausted; }
+
+private:
+    bool search(vector<int>& counts, int machines) {
+        int first = firstClass(counts);
+        if (first < 0) {
+            return true;
+        }
+        if (machines <= 0 || units(counts) > static_cast<long long>(machines) * capacity) {
+            return false;
+        }
+
+        vector<uint64_t> key;
+        table.pack(counts, key);
+        if (table.find(key) > machines) {
+            return false;
+        }
+        if (static_cast<long long>(table.size()) >= kMaxConfigurationStates) {
+            exhausted = true;
+            return false;
+        }
+
+        for (int index : withClass[first]) {
+            const vector<int>& config = configs[index];
+            if (!available(config, counts) || !maximal(config, counts)) {
+                continue;
+            }
+            apply(counts, config, -1);
+            chosen.push_back(index);
+            bool found = search(counts, machines - 1);
+            apply(counts, config, 1);
+
+            if (found) {
+                return true;
+            }
+            chosen.pop_back();
+            if (exhausted) {
+                return false;
+            }
+        }
+
+        table.store(key, machines + 1);
+        return false;
+    }
+
+    // Whether no job left over after config fits in the room config leaves.
+    bool maximal(const vector<int>& config, const vector<int>& counts) const {
+        long long room = capacity - units(config);
+        for (size_t i = sizes.size(); i-- > 0;) {
+            if (counts[i] > config[i]) {
+                return sizes[i] > room;
+            }
+        }
+        return true;
+    }
+
+    void enumerate(size_t index, int room, const vector<int>& counts, vector<int>& config) {
+        if (index == sizes.size()) {
+            if (units(config) > 0) {
+                configs.push_back(config);
+            }
+            return;
+        }
+        for (int take = 0; take <= counts[index] && take * sizes[index] <= room; ++take) {
+            config[index] = take;
+            enumerate(index + 1, room - take * sizes[index], counts, config);
+        }
+        config[index] = 0;
+    }
+
+    long long units(const vector<int>& counts) const {
+        long long total = 0;
+        for (size_t i = 0; i < counts.size(); ++i) {
+            total += static_cast<long long>(counts[i]) * sizes[i];
+        }
+        return total;
+    }
+
+    static int firstClass(const vector<int>& counts) {
+        for (size_t i = 0; i < counts.size(); ++i) {
+            if (counts[i] > 0) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    static bool available(const vector<int>& config, const vector<int>& counts) {
+        for (size_t i = 0; i < config.size(); ++i) {
+            if (config[i] > counts[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void apply(vector<int>& counts, const vector<int>& config, int sign) {
+        for (size_t i = 0; i < config.size(); ++i) {
+            counts[i] += sign * config[i];
+        }
+    }
+
+    const vector<int>& sizes;
+    int capacity;
+    PackedStateTable table;
+    vector<vector<int>> configs;
+    // Configurations by their largest class, best filled first.
+    vector<vector<int>> withClass;
+    vector<int> chosen;
+    bool exhausted;
+};
+
+enum class DualOutcome { Fits, TooSmall, Outgrown };
+
+// The dual test for target T: a schedule with Cmax <= (1 + epsilon) * T, or
+// proof that T < OPT.
+static DualOutcome dualTest(const vector<int>& tasks, int numMachines, double epsilon, long long target,
+                            vector<int>& taskAssignments) {
+    int K = static_cast<int>(ceil(1.0 / (epsilon * epsilon) - 1e-9));
+
+    vector<int> longJobs, shortJobs;
+    for (int j = 0; j < static_cast<int>(tasks.size()); ++j) {
+        (tasks[j] > epsilon * target ? longJobs : shortJobs).push_back(j);
+    }
+
+    // Size classes of the rounded long jobs, largest first.
+    vector<int> rounded(tasks.size(), 0);
+    vector<int> sizes;
+    for (int job : longJobs) {
+        rounded[job] = static_cast<int>(static_cast<long long>(tasks[job]) * K / target);
+        sizes.push_back(rounded[job]);
+    }
+    sort(sizes.begin(), sizes.end(), greater<int>());
+    sizes.erase(unique(sizes.begin(), sizes.end()), sizes.end());
+
+    vector<int> counts(sizes.size(), 0);
+    vector<vector<int>> classJobs(sizes.size());
+    for (int job : longJobs) {
+        int cls = static_cast<int>(lower_bound(sizes.begin(), sizes.end(), rounded[job], greater<int>()) - sizes.begin());
+        counts[cls]++;
+        classJobs[cls].push_back(job);
+    }
+
+    ConfigurationDP dp(sizes, counts, K);
+    if (!dp.fits(counts, numMachines)) {
+        return dp.outgrown() ? DualOutcome::Outgrown : DualOutcome::TooSmall;
+    }
+
+    vector<long long> loads(numMachines, 0);
+    int machine = 0;
+    for (const vector<int>& config : dp.packing()) {
+        for (size_t cls = 0; cls < config.size(); ++cls) {
+            for (int take = 0; take < config[cls]; ++take) {
+                int job = classJobs[cls].back();
+                classJobs[cls].pop_back();
+                taskAssignments[job] = machine + 1;
+                loads[machine] += tasks[job];
+            }
+        }
+        machine++;
+    }
+
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>> leastLoaded;
+    for (int i = 0; i < numMachines; ++i) {
+        leastLoaded.push({loads[i], i});
+    }
+    for (int job : shortJobs) {
+        pair<long long, int> top = leastLoaded.top();
+        if (top.first > target) {
+            return DualOutcome::TooSmall;
+        }
+        leastLoaded.pop();
+        taskAssignments[job] = top.second + 1;
+        leastLoaded.push({top.first + tasks[job], top.second});
+    }
+    return DualOutcome::Fits;
+}
+
+DualApproximationResult dualApproximation(const vector<int>& tasks, int numMachines, double epsilon,
+                                          vector<int>& taskAssignments) {
+    int numJobs = static_cast<int>(tasks.size());
+    taskAssignments.assign(numJobs, 1);
+    if (numJobs == 0 || numMachines <= 0) {
+        return {0, epsilon};
+    }
+
+    auto scheduleCmax = [&](const vector<int>& assignments) {
+        vector<long long> loads(numMachines, 0);
+        for (int j = 0; j < numJobs; ++j) {
+            loads[assignments[j] - 1] += tasks[j];
+        }
+        return *max_element(loads.begin(), loads.end());
+    };
+
+    // LPT in input order is the starting upper bound.
+    vector<int> order(numJobs);
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](int a, int b) { return tasks[a] > tasks[b]; });
+    vector<int> orderedTasks(numJobs), lptAssignments(numJobs);
+    for (int i = 0; i < numJobs; ++i) {
+        orderedTasks[i] = tasks[order[i]];
+    }
+    listSchedule(orderedTasks, numMachines, lptAssignments);
+    for (int i = 0; i < numJobs; ++i) {
+        taskAssignments[order[i]] = lptAssignments[i];
+    }
+    long long bestCmax = scheduleCmax(taskAssignments);
+
+    long long lowerBound = max(1LL, makespanLowerBound(tasks, numMachines));
+    vector<int> candidate(numJobs);
+
+    while (true) {
+        long long low = lowerBound, high = bestCmax;
+        bool outgrown = false;
+
+        while (low < high) {
+            long long target = low + (high - low) / 2;
+            DualOutcome outcome = dualTest(tasks, numMachines, epsilon, target, candidate);
+            if (outcome == DualOutcome::Outgrown) {
+                outgrown = true;
+                break;
+            }
+            if (outcome == DualOutcome::TooSmall) {
+                low = target + 1;
+                continue;
+            }
+
+            high = target;
+            long long Cmax = scheduleCmax(candidate);
+            if (Cmax < bestCmax) {
+                bestCmax = Cmax;
+                taskAssignments = candidate;
+            }
+        }
+
+        if (!outgrown) {
+            break;
+        }
+        epsilon *= 1.5;
+    }
+
+    return {static_cast<int>(bestCmax), epsilon};
+}
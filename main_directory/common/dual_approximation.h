@@ -0,0 +1,32 @@
+#ifndef DUAL_APPROXIMATION_H
+#define DUAL_APPROXIMATION_H
+
+#include <vector>
+
+// Failed DP states remembered for one target makespan before the engine
+// retries with a coarser epsilon. A state takes one packed key of a few 64-bit
+// words plus an int, in a table kept at most half full, so the cap is about
+// 100 MB at 45 size classes (epsilon = 0.1) and far less at epsilon = 0.2.
+const long long kMaxConfigurationStates = 1 << 20;
+
+struct DualApproximationResult {
+    int Cmax;
+    double epsilon;
+};
+
+// Hochbaum-Shmoys PTAS. A binary search on the target T runs the dual test:
+// jobs longer than epsilon * T are rounded down to multiples of T / K
+// (K = ceil(1 / epsilon^2)), a search over machine configurations decides
+// whether m machines hold them, and the short jobs are then added to the
+// least loaded machine while it is still at most T. The smallest T that
+// passes gives Cmax <= (1 + epsilon) * OPT. DP states are the remaining job
+// counts per rounded size, bit-packed into a few 64-bit words and kept in an
+// open-addressing table, and a configuration is only tried if it holds one of
+// the longest remaining jobs and leaves no room for any other. When a search
+// outgrows kMaxConfigurationStates the binary search restarts with
+// epsilon * 1.5; the epsilon actually achieved is returned. Writes the
+// 1-based machine of each task to taskAssignments.
+DualApproximationResult dualApproximation(const std::vector<int>& tasks, int numMachines, double epsilon,
+                                          std::vector<int>& taskAssignments);
+
+#endif
@@ -0,0 +1,83 @@
+#include "dynamic_schedule.h"
+#include <algorithm>
+#include <climits>
+#include <iterator>
+using namespace std;
+
+DynamicSchedule::DynamicSchedule(int numMachines)
+    : machineJobs(numMachines), mostLoaded(vector<long long>(numMachines, 0)),
+      leastLoaded(vector<long long>(numMachines, 0)), liveJobs(0) {}
+
+void DynamicSchedule::place(int job, int machine) {
+    jobs[job].machine = machine;
+    machineJobs[machine].insert({jobs[job].duration, job});
+    mostLoaded.add(machine, jobs[job].duration);
+    leastLoaded.add(machine, -jobs[job].duration);
+}
+
+void DynamicSchedule::unplace(int job) {
+    int machine = jobs[job].machine;
+    machineJobs[machine].erase({jobs[job].duration, job});
+    mostLoaded.add(machine, -jobs[job].duration);
+    leastLoaded.add(machine, jobs[job].duration);
+    jobs[job].machine = -1;
+}
+
+int DynamicSchedule::insertJob(int duration) {
+    int job = static_cast<int>(jobs.size());
+    jobs.push_back({duration, -1});
+    place(job, leastLoaded.top());
+    liveJobs++;
+    return job;
+}
+
+bool DynamicSchedule::removeJob(int job) {
+    if (job < 0 || job >= static_cast<int>(jobs.size()) || jobs[job].machine < 0) {
+        return false;
+    }
+    unplace(job);
+    liveJobs--;
+    return true;
+}
+
+int DynamicSchedule::rebalance(int maxMoves) {
+    int moves = 0;
+    while (moves < maxMoves) {
+        int source = mostLoaded.top();
+        int target = leastLoaded.top();
+        long long gap = load(source) - load(target);
+
+        // Moving a job of duration d leaves the pair at max(source - d,
+        // target + d), which is best for d near gap / 2 and no better for
+        // d >= gap.
+        set<pair<int, int>>& candidates = machineJobs[source];
+        auto above = candidates.lower_bound({static_cast<int>(min<long long>(gap / 2 + 1, INT_MAX)), INT_MIN});
+        auto best = candidates.end();
+        long long bestDistance = gap;
+        if (above != candidates.end() && above->first < gap) {
+            best = above;
+            bestDistance = 2LL * above->first - gap;
+        }
+        if (above != candidates.begin()) {
+            auto below = prev(above);
+            if (below->first > 0 && gap - 2LL * below->first < bestDistance) {
+                best = below;
+            }
+        }
+        if (best == candidates.end()) {
+            break;
+        }
+
+        // The set node itself moves to the target machine, so a repair step
+        // never allocates.
+        int duration = best->first;
+        jobs[best->second].machine = target;
+        machineJobs[target].insert(candidates.extract(best));
+        mostLoaded.add(source, -duration);
+        leastLoaded.add(source, duration);
+        mostLoaded.add(target, duration);
+        leastLoaded.add(target, -duration);
+        moves++;
+    }
+    return moves;
+}
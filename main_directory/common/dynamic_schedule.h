@@ -0,0 +1,51 @@
+#ifndef DYNAMIC_SCHEDULE_H
+#define DYNAMIC_SCHEDULE_H
+
+#include "load_heap.h"
+#include <set>
+#include <utility>
+#include <vector>
+
+// A schedule on identical machines that is kept up to date while jobs arrive
+// and get cancelled, instead of being rebuilt from the full job list. Every
+// machine keeps its jobs ordered by duration, and the loads live in two
+// indexed heaps (most and least loaded), so an update costs
+// O(log n + log m).
+class DynamicSchedule {
+public:
+    explicit DynamicSchedule(int numMachines);
+
+    // Places the job on the least-loaded machine and returns its id.
+    int insertJob(int duration);
+    // Takes a job off its machine; false if the id is unknown or already
+    // removed.
+    bool removeJob(int job);
+    // Bounded repair: at most maxMoves times, moves the job of the most
+    // loaded machine whose duration is closest to half the gap to the least
+    // loaded one, as long as that narrows the gap. Returns the moves made.
+    int rebalance(int maxMoves);
+
+    long long Cmax() const { return mostLoaded.maxLoad(); }
+    long long load(int machine) const { return mostLoaded.load(machine); }
+    // 0-based machine of the job, or -1 once it has been removed.
+    int machineOf(int job) const { return jobs[job].machine; }
+    int numJobs() const { return liveJobs; }
+
+private:
+    struct JobSlot {
+        int duration;
+        int machine;
+    };
+
+    void place(int job, int machine);
+    void unplace(int job);
+
+    std::vector<JobSlot> jobs;
+    std::vector<std::set<std::pair<int, int>>> machineJobs;
+    LoadHeap mostLoaded;
+    // Holds the negated loads, so its top is the least-loaded machine.
+    LoadHeap leastLoaded;
+    int liveJobs;
+};
+
+#endif
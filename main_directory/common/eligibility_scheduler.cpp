@@ -0,0 +1,111 @@
+#include "eligibility_scheduler.h"
+#include "simd_argmin.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <utility>
+using namespace std;
+
+EligibilitySets::EligibilitySets(int numJobs, int numMachines, const vector<int>& offsets,
+                                 const vector<int>& machines)
+    : machineCount(numMachines), jobClass(numJobs, 0), classOffsets(1, 0) {
+    map<vector<int>, int> classIndex;
+    vector<int> jobMachines;
+
+    for (int job = 0; job < numJobs; ++job) {
+        jobMachines.clear();
+        if (offsets.empty()) {
+            for (int machine = 0; machine < numMachines; ++machine) {
+                jobMachines.push_back(machine);
+            }
+        } else {
+            for (int k = offsets[job]; k < offsets[job + 1]; ++k) {
+                if (machines[k] >= 0 && machines[k] < numMachines) {
+                    jobMachines.push_back(machines[k]);
+                }
+            }
+            sort(jobMachines.begin(), jobMachines.end());
+            jobMachines.erase(unique(jobMachines.begin(), jobMachines.end()), jobMachines.end());
+        }
+
+        auto inserted = classIndex.insert({jobMachines, numClasses()});
+        if (inserted.second) {
+            uint64_t mask = 0;
+            for (int machine : jobMachines) {
+                classMachines.push_back(machine);
+                if (machine < kMaxMaskedMachines) {
+                    mask |= uint64_t(1) << machine;
+                }
+            }
+            classOffsets.push_back(static_cast<int>(classMachines.size()));
+            classMasks.push_back(mask);
+        }
+        jobClass[job] = inserted.first->second;
+    }
+}
+
+bool EligibilitySets::usesMasks() const {
+    return machineCount <= kMaxMaskedMachines;
+}
+
+typedef priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> MachineHeap;
+
+int eligibleListSchedule(const vector<int>& tasks, const vector<int>& jobOrder, const EligibilitySets& sets,
+                         vector<int>& taskAssignments) {
+    int numMachines = sets.numMachines();
+    taskAssignments.assign(tasks.size(), 0);
+
+    // Padding machines keep an unreachable load and are never eligible.
+    int paddedCount = (numMachines + kArgminPadding - 1) / kArgminPadding * kArgminPadding;
+    vector<int> loads(max(paddedCount, kArgminPadding), numeric_limits<int>::max());
+    fill(loads.begin(), loads.begin() + numMachines, 0);
+    int maxLoad = 0;
+
+    if (sets.usesMasks()) {
+        for (int job : jobOrder) {
+            int machine = argminEligibleLoad(loads.data(), paddedCount, sets.mask(sets.classOf(job)));
+            if (machine < 0) {
+                return -1;
+            }
+            loads[machine] += tasks[job];
+            maxLoad = max(maxLoad, loads[machine]);
+            taskAssignments[job] = machine + 1;
+        }
+        return maxLoad;
+    }
+
+    // Loads only grow, so a heap entry is never above its machine's load: an
+    // entry that matches the current load sits on top only if no eligible
+    // machine is lighter (or as light with a lower index).
+    vector<MachineHeap> heaps(sets.numClasses());
+    vector<bool> built(sets.numClasses(), false);
+    for (int job : jobOrder) {
+        int eligibilityClass = sets.classOf(job);
+        MachineHeap& heap = heaps[eligibilityClass];
+        if (!built[eligibilityClass]) {
+            for (const int* machine = sets.begin(eligibilityClass); machine != sets.end(eligibilityClass); ++machine) {
+                heap.push({loads[*machine], *machine});
+            }
+            built[eligibilityClass] = true;
+        }
+        if (heap.empty()) {
+            return -1;
+        }
+
+        while (heap.top().first != loads[heap.top().second]) {
+            int machine = heap.top().second;
+            heap.pop();
+            heap.push({loads[machine], machine});
+        }
+
+        int machine = heap.top().second;
+        heap.pop();
+        loads[machine] += tasks[job];
+        heap.push({loads[machine], machine});
+        maxLoad = max(maxLoad, loads[machine]);
+        taskAssignments[job] = machine + 1;
+    }
+    return maxLoad;
+}
@@ -0,0 +1,42 @@
+#ifndef ELIGIBILITY_SCHEDULER_H
+#define ELIGIBILITY_SCHEDULER_H
+
+#include <cstdint>
+#include <vector>
+
+// Machine eligibility for P|M_j|Cmax. Jobs with the same set of machines
+// share one eligibility class; each class keeps its machines as a CSR list
+// and, when m <= kMaxMaskedMachines, as a bitmask too.
+class EligibilitySets {
+public:
+    // offsets and machines are the CSR lists of an Instance (0-based machines,
+    // in any order); empty lists make every machine eligible for every job.
+    EligibilitySets(int numJobs, int numMachines, const std::vector<int>& offsets, const std::vector<int>& machines);
+
+    int numMachines() const { return machineCount; }
+    int numClasses() const { return static_cast<int>(classOffsets.size()) - 1; }
+    bool usesMasks() const;
+
+    int classOf(int job) const { return jobClass[job]; }
+    uint64_t mask(int eligibilityClass) const { return classMasks[eligibilityClass]; }
+    const int* begin(int eligibilityClass) const { return classMachines.data() + classOffsets[eligibilityClass]; }
+    const int* end(int eligibilityClass) const { return classMachines.data() + classOffsets[eligibilityClass + 1]; }
+
+private:
+    int machineCount;
+    std::vector<int> jobClass;
+    std::vector<int> classOffsets;
+    std::vector<int> classMachines;
+    std::vector<uint64_t> classMasks;
+};
+
+// Assigns jobs in jobOrder one by one to the least-loaded eligible machine
+// (lowest index on ties), writes the 1-based machine of every job in input
+// order and returns Cmax, or -1 if some job has no eligible machine. Up to
+// kMaxMaskedMachines machines the choice is one masked SIMD argmin over the
+// padded loads; beyond that every eligibility class keeps a lazy min-heap of
+// (load, machine) whose stale entries are refreshed when they surface.
+int eligibleListSchedule(const std::vector<int>& tasks, const std::vector<int>& jobOrder, const EligibilitySets& sets,
+                         std::vector<int>& taskAssignments);
+
+#endif
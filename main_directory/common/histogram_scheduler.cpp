@@ -0,0 +1,94 @@
+#include "histogram_scheduler.h"
+#include <algorithm>
+using namespace std;
+
+vector<DurationRun> buildHistogram(vector<int>::const_iterator first, vector<int>::const_iterator last) {
+    vector<int> sortedTasks(first, last);
+    orderTasks(sortedTasks.begin(), sortedTasks.end(), TaskOrder::Ascending);
+
+    vector<DurationRun> runs;
+    for (int task : sortedTasks) {
+        if (runs.empty() || runs.back().duration != task) {
+            runs.push_back({task, 0});
+        }
+        runs.back().count++;
+    }
+    return runs;
+}
+
+HistogramScheduler::HistogramScheduler(int numMachines)
+    : machineLoads(numMachines, 0), jobsPerMachine(numMachines, 0) {}
+
+void HistogramScheduler::reset() {
+    fill(machineLoads.begin(), machineLoads.end(), 0);
+}
+
+// Number of jobs of this duration that could start at or before value, summed
+// over all machines.
+long long HistogramScheduler::jobsStartingBy(long long value, int duration) const {
+    long long jobs = 0;
+    for (long long load : machineLoads) {
+        if (load <= value) {
+            jobs += (value - load) / duration + 1;
+        }
+    }
+    return jobs;
+}
+
+// Greedy assignment of equal jobs is a merge of the per-machine start times
+// load, load + p, load + 2p, ... ordered by (start, machine index), so the run
+// takes the count smallest of them. Binary search finds the start time of the
+// last job; everything earlier is taken, and ties at that time go to the
+// lowest machine indices.
+void HistogramScheduler::assignRun(int duration, long long count) {
+    if (count <= 0 || machineLoads.empty()) {
+        return;
+    }
+
+    long long low = *min_element(machineLoads.begin(), machineLoads.end());
+    long long high = low + (count - 1) * duration;
+    while (low < high) {
+        long long mid = low + (high - low) / 2;
+        if (jobsStartingBy(mid, duration) >= count) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    long long lastStart = low;
+
+    long long remaining = count;
+    for (size_t i = 0; i < machineLoads.size(); ++i) {
+        jobsPerMachine[i] = 0;
+        if (machineLoads[i] < lastStart) {
+            jobsPerMachine[i] = (lastStart - 1 - machineLoads[i]) / duration + 1;
+            remaining -= jobsPerMachine[i];
+        }
+    }
+    for (size_t i = 0; i < machineLoads.size() && remaining > 0; ++i) {
+        if (machineLoads[i] <= lastStart && (lastStart - machineLoads[i]) % duration == 0) {
+            jobsPerMachine[i]++;
+            remaining--;
+        }
+    }
+
+    for (size_t i = 0; i < machineLoads.size(); ++i) {
+        machineLoads[i] += jobsPerMachine[i] * duration;
+    }
+}
+
+void HistogramScheduler::assignHistogram(const vector<DurationRun>& runs, TaskOrder order) {
+    if (order == TaskOrder::Ascending) {
+        for (const DurationRun& run : runs) {
+            assignRun(run.duration, run.count);
+        }
+    } else {
+        for (auto it = runs.rbegin(); it != runs.rend(); ++it) {
+            assignRun(it->duration, it->count);
+        }
+    }
+}
+
+long long HistogramScheduler::maxLoad() const {
+    return machineLoads.empty() ? 0 : *max_element(machineLoads.begin(), machineLoads.end());
+}
@@ -0,0 +1,40 @@
+#ifndef HISTOGRAM_SCHEDULER_H
+#define HISTOGRAM_SCHEDULER_H
+
+#include "task_ordering.h"
+#include <vector>
+
+// A run of equal-length jobs: the high-multiplicity form of a task list.
+struct DurationRun {
+    int duration;
+    long long count;
+};
+
+// Histogram of [first, last) as runs in ascending duration order.
+std::vector<DurationRun> buildHistogram(std::vector<int>::const_iterator first, std::vector<int>::const_iterator last);
+
+// List scheduling over a histogram instead of a job list. A whole run of equal
+// jobs is placed in O(m log(count * duration)), so the cost depends on the
+// number of distinct durations and m but not on n. Feeding runs in LPT/SPT
+// order (or both halves of a split one after the other) ends with exactly the
+// loads listSchedule() produces for the expanded job list.
+class HistogramScheduler {
+public:
+    explicit HistogramScheduler(int numMachines);
+
+    void reset();
+
+    void assignRun(int duration, long long count);
+    void assignHistogram(const std::vector<DurationRun>& runs, TaskOrder order);
+
+    long long load(int machine) const { return machineLoads[machine]; }
+    long long maxLoad() const;
+
+private:
+    long long jobsStartingBy(long long value, int duration) const;
+
+    std::vector<long long> machineLoads;
+    std::vector<long long> jobsPerMachine;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#include "instance_io.h"
+#include <string>
+using namespace std;
+
+void skipInputHeader(istream& input) {
+    string firstLine;
+    getline(input, firstLine);
+}
+
+bool readInstance(istream& input, Instance& instance) {
+    if (!(input >> instance.numJobs >> instance.numMachines >> instance.classNumber >> instance.instanceNumber)) {
+        return false;
+    }
+
+    instance.tasks.resize(instance.numJobs);
+    for (int i = 0; i < instance.numJobs; ++i) {
+        input >> instance.tasks[i];
+    }
+
+    instance.weights.clear();
+    instance.speeds.clear();
+    instance.processingTimes.clear();
+    instance.precedences.clear();
+    instance.eligibleOffsets.clear();
+    instance.eligibleMachines.clear();
+    string keyword;
+    while ((input >> ws).peek() == 's' || input.peek() == 't' || input.peek() == 'e' ||
+           input.peek() == 'w') {
+        input >> keyword;
+        if (keyword == "weights") {
+            instance.weights.resize(instance.numJobs);
+            for (int& weight : instance.weights) {
+                input >> weight;
+            }
+        } else if (keyword == "speeds") {
+            instance.speeds.resize(instance.numMachines);
+            for (double& speed : instance.speeds) {
+                input >> speed;
+            }
+        } else if (keyword == "eligible") {
+            instance.eligibleOffsets.assign(1, 0);
+            for (int job = 0; job < instance.numJobs; ++job) {
+                int count = 0;
+                input >> count;
+                for (int k = 0; k < count; ++k) {
+                    int machine = 0;
+                    input >> machine;
+                    instance.eligibleMachines.push_back(machine);
+                }
+                instance.eligibleOffsets.push_back(static_cast<int>(instance.eligibleMachines.size()));
+            }
+        } else if (keyword == "edges") {
+            size_t edgeCount = 0;
+            input >> edgeCount;
+            instance.precedences.resize(edgeCount);
+            for (pair<int, int>& edge : instance.precedences) {
+                input >> edge.first >> edge.second;
+            }
+        } else {
+            instance.processingTimes.resize(static_cast<size_t>(instance.numJobs) * instance.numMachines);
+            for (int& time : instance.processingTimes) {
+                input >> time;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,40 @@
+#ifndef INSTANCE_IO_H
+#define INSTANCE_IO_H
+
+#include <istream>
+#include <utility>
+#include <vector>
+
+struct Instance {
+    int numJobs;
+    int numMachines;
+    int classNumber;
+    int instanceNumber;
+    std::vector<int> tasks;
+    // Job weights for weighted completion time, empty for unit weights.
+    std::vector<int> weights;
+    // Machine speed factors, empty for identical machines.
+    std::vector<double> speeds;
+    // Per-machine processing times, job-major (n x m), empty unless the
+    // machines are unrelated.
+    std::vector<int> processingTimes;
+    // Precedence constraints (u, v): job v cannot start before job u ends.
+    std::vector<std::pair<int, int>> precedences;
+    // Machines each job may run on, as CSR lists: job j's machines are
+    // eligibleMachines[eligibleOffsets[j] .. eligibleOffsets[j + 1]). Empty
+    // when every job may run anywhere.
+    std::vector<int> eligibleOffsets;
+    std::vector<int> eligibleMachines;
+};
+
+// Skips the instance-count line at the top of input.txt.
+void skipInputHeader(std::istream& input);
+
+// Reads the next "n m class instance" header and its n durations, plus the
+// optional blocks that may follow the durations: "weights w1 ... wn",
+// "speeds s1 ... sm", "times" with n rows of m processing times, "edges e"
+// with e 0-based job pairs "u v", and "eligible" with one row "k i1 ... ik" of
+// 0-based machines per job. Returns false once the input is exhausted.
+bool readInstance(std::istream& input, Instance& instance);
+
+#endif
@@ -0,0 +1,182 @@
+#include "island_genetic.h"
+#include <algorithm>
+#include <random>
+#include <thread>
+using namespace std;
+
+const int P = kIslandPopulation;
+
+struct Island {
+    vector<int> genes;
+    vector<int> nextGenes;
+    vector<int> loads;
+    vector<int> fitness;
+    mt19937 rng;
+};
+
+static void evaluate(Island& island, const vector<int>& tasks, int numMachines) {
+    int numJobs = static_cast<int>(tasks.size());
+    fill(island.loads.begin(), island.loads.end(), 0);
+
+    if (numMachines <= kMaskedFitnessMachines) {
+        for (int machine = 0; machine < numMachines; ++machine) {
+            int* loads = &island.loads[machine * P];
+            for (int job = 0; job < numJobs; ++job) {
+                const int* genes = &island.genes[job * P];
+                int duration = tasks[job];
+                for (int i = 0; i < P; ++i) {
+                    loads[i] += genes[i] == machine ? duration : 0;
+                }
+            }
+        }
+    } else {
+        for (int job = 0; job < numJobs; ++job) {
+            const int* genes = &island.genes[job * P];
+            for (int i = 0; i < P; ++i) {
+                island.loads[genes[i] * P + i] += tasks[job];
+            }
+        }
+    }
+
+    int* fitness = island.fitness.data();
+    copy(island.loads.begin(), island.loads.begin() + P, fitness);
+    for (int machine = 1; machine < numMachines; ++machine) {
+        const int* loads = &island.loads[machine * P];
+        for (int i = 0; i < P; ++i) {
+            fitness[i] = max(fitness[i], loads[i]);
+        }
+    }
+}
+
+static int fittest(const Island& island) {
+    return static_cast<int>(min_element(island.fitness.begin(), island.fitness.end()) - island.fitness.begin());
+}
+
+static void evolve(Island& island, const vector<int>& tasks, int numMachines, int generations, long long targetCmax) {
+    int numJobs = static_cast<int>(tasks.size());
+    uniform_int_distribution<int> pickIndividual(0, P - 1);
+    uniform_int_distribution<int> pickJob(0, numJobs - 1);
+    uniform_int_distribution<int> pickMachine(0, numMachines - 1);
+
+    for (int generation = 0; generation < generations; ++generation) {
+        int elite = fittest(island);
+        if (island.fitness[elite] <= targetCmax) {
+            return;
+        }
+        for (int job = 0; job < numJobs; ++job) {
+            island.nextGenes[job * P] = island.genes[job * P + elite];
+        }
+
+        for (int child = 1; child < P; ++child) {
+            int a = pickIndividual(island.rng), b = pickIndividual(island.rng);
+            int mother = island.fitness[a] <= island.fitness[b] ? a : b;
+            a = pickIndividual(island.rng), b = pickIndividual(island.rng);
+            int father = island.fitness[a] <= island.fitness[b] ? a : b;
+
+            unsigned bits = 0;
+            for (int job = 0; job < numJobs; ++job) {
+                if (job % 32 == 0) {
+                    bits = island.rng();
+                }
+                int parent = (bits >> (job % 32)) & 1 ? mother : father;
+                island.nextGenes[job * P + child] = island.genes[job * P + parent];
+            }
+            island.nextGenes[pickJob(island.rng) * P + child] = pickMachine(island.rng);
+        }
+
+        swap(island.genes, island.nextGenes);
+        evaluate(island, tasks, numMachines);
+    }
+}
+
+int islandGenetic(const vector<int>& tasks, int numMachines, const vector<vector<int>>& seeds, int numIslands,
+                  int generations, int migrationInterval, long long targetCmax, vector<int>& taskAssignments) {
+    int numJobs = static_cast<int>(tasks.size());
+    taskAssignments.assign(numJobs, 1);
+    if (numJobs == 0 || numMachines <= 0 || numIslands <= 0) {
+        return 0;
+    }
+
+    vector<Island> islands(numIslands);
+    for (int r = 0; r < numIslands; ++r) {
+        Island& island = islands[r];
+        island.genes.resize(static_cast<size_t>(numJobs) * P);
+        island.nextGenes.resize(island.genes.size());
+        island.loads.resize(static_cast<size_t>(numMachines) * P);
+        island.fitness.resize(P);
+        island.rng.seed(5489u + r);
+
+        uniform_int_distribution<int> pickMachine(0, numMachines - 1);
+        for (int& gene : island.genes) {
+            gene = pickMachine(island.rng);
+        }
+    }
+
+    for (size_t s = 0; s < seeds.size() && static_cast<int>(s) < numIslands * P; ++s) {
+        Island& island = islands[s % numIslands];
+        int individual = static_cast<int>(s / numIslands);
+        for (int job = 0; job < numJobs; ++job) {
+            island.genes[job * P + individual] = seeds[s][job];
+        }
+    }
+
+    for (Island& island : islands) {
+        evaluate(island, tasks, numMachines);
+    }
+
+    auto bestCmax = [&]() {
+        int best = islands[0].fitness[fittest(islands[0])];
+        for (const Island& island : islands) {
+            best = min(best, island.fitness[fittest(island)]);
+        }
+        return best;
+    };
+
+    for (int done = 0; done < generations && bestCmax() > targetCmax; done += migrationInterval) {
+        int epoch = min(migrationInterval, generations - done);
+        vector<thread> threads;
+        for (Island& island : islands) {
+            threads.emplace_back(evolve, ref(island), cref(tasks), numMachines, epoch, targetCmax);
+        }
+        for (thread& t : threads) {
+            t.join();
+        }
+
+        // Ring migration: the best of each island replaces the worst of the
+        // next one. Emigrants are taken before anyone is overwritten.
+        if (numIslands == 1) {
+            continue;
+        }
+        vector<int> emigrants(static_cast<size_t>(numJobs) * numIslands);
+        vector<int> emigrantFitness(numIslands);
+        for (int r = 0; r < numIslands; ++r) {
+            int best = fittest(islands[r]);
+            for (int job = 0; job < numJobs; ++job) {
+                emigrants[r * numJobs + job] = islands[r].genes[job * P + best];
+            }
+            emigrantFitness[r] = islands[r].fitness[best];
+        }
+        for (int r = 0; r < numIslands; ++r) {
+            Island& target = islands[(r + 1) % numIslands];
+            int worst = static_cast<int>(max_element(target.fitness.begin(), target.fitness.end()) -
+                                         target.fitness.begin());
+            for (int job = 0; job < numJobs; ++job) {
+                target.genes[job * P + worst] = emigrants[r * numJobs + job];
+            }
+            target.fitness[worst] = emigrantFitness[r];
+        }
+    }
+
+    int bestIsland = 0;
+    for (int r = 1; r < numIslands; ++r) {
+        if (islands[r].fitness[fittest(islands[r])] < islands[bestIsland].fitness[fittest(islands[bestIsland])]) {
+            bestIsland = r;
+        }
+    }
+    const Island& island = islands[bestIsland];
+    int best = fittest(island);
+    for (int job = 0; job < numJobs; ++job) {
+        taskAssignments[job] = island.genes[job * P + best] + 1;
+    }
+    return island.fitness[best];
+}
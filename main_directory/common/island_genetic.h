@@ -0,0 +1,28 @@
+#ifndef ISLAND_GENETIC_H
+#define ISLAND_GENETIC_H
+
+#include <vector>
+
+// Individuals per island.
+const int kIslandPopulation = 32;
+
+// Machine counts up to this value evaluate fitness with the branch-free
+// compare-and-add loop; larger ones scatter loads job by job.
+const int kMaskedFitnessMachines = 16;
+
+// Island-model genetic algorithm for P||Cmax. Each island stores its
+// population structure-of-arrays: the machine of job j in individual i sits
+// at genes[j * kIslandPopulation + i], and loads are kept machine-major the
+// same way, so fitness evaluation runs along contiguous rows of individuals.
+// A generation is binary tournament selection, uniform crossover, one-gene
+// mutation and elitism, at a fixed O(population * n * m) cost. Islands evolve
+// on their own threads, and every migrationInterval generations each island's
+// best replaces the worst of the next island in a ring. seeds (0-based
+// machine per task) are injected as initial individuals, round robin over the
+// islands. Stops after generations generations or at targetCmax; writes the
+// 1-based machine of each task to taskAssignments and returns Cmax.
+int islandGenetic(const std::vector<int>& tasks, int numMachines, const std::vector<std::vector<int>>& seeds,
+                  int numIslands, int generations, int migrationInterval, long long targetCmax,
+                  std::vector<int>& taskAssignments);
+
+#endif
@@ -0,0 +1,84 @@
+#include "largest_differencing.h"
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <utility>
+using namespace std;
+
+int largestDifferencing(const vector<int>& orderedTasks, int numMachines, vector<int>& taskAssignments) {
+    int numJobs = static_cast<int>(orderedTasks.size());
+    if (numJobs == 0) {
+        return 0;
+    }
+
+    // Slot s = t * m + k is subset k of tuple t; subsets are kept in
+    // descending order of their sums.
+    int m = numMachines;
+    vector<long long> slotSum(static_cast<size_t>(numJobs) * m, 0);
+    vector<int> slotHead(static_cast<size_t>(numJobs) * m, -1);
+    vector<int> slotTail(static_cast<size_t>(numJobs) * m, -1);
+    vector<int> nextJob(numJobs, -1);
+
+    priority_queue<pair<long long, int>> spreads;
+    for (int job = 0; job < numJobs; ++job) {
+        size_t first = static_cast<size_t>(job) * m;
+        slotSum[first] = orderedTasks[job];
+        slotHead[first] = job;
+        slotTail[first] = job;
+        spreads.push({orderedTasks[job], job});
+    }
+
+    vector<long long> mergedSum(m);
+    vector<int> mergedHead(m), mergedTail(m), order(m);
+
+    while (spreads.size() > 1) {
+        int a = spreads.top().second;
+        spreads.pop();
+        int b = spreads.top().second;
+        spreads.pop();
+
+        size_t baseA = static_cast<size_t>(a) * m;
+        size_t baseB = static_cast<size_t>(b) * m;
+
+        // Largest subset of a with the smallest of b, and so on.
+        for (int k = 0; k < m; ++k) {
+            size_t slotA = baseA + k;
+            size_t slotB = baseB + (m - 1 - k);
+            mergedSum[k] = slotSum[slotA] + slotSum[slotB];
+
+            if (slotHead[slotA] < 0) {
+                mergedHead[k] = slotHead[slotB];
+                mergedTail[k] = slotTail[slotB];
+            } else {
+                mergedHead[k] = slotHead[slotA];
+                mergedTail[k] = slotHead[slotB] < 0 ? slotTail[slotA] : slotTail[slotB];
+                if (slotHead[slotB] >= 0) {
+                    nextJob[slotTail[slotA]] = slotHead[slotB];
+                }
+            }
+        }
+
+        // Ties keep slot order; std::sort sorts in place where stable_sort
+        // would allocate a buffer on every merge.
+        iota(order.begin(), order.end(), 0);
+        sort(order.begin(), order.end(), [&](int x, int y) {
+            return mergedSum[x] != mergedSum[y] ? mergedSum[x] > mergedSum[y] : x < y;
+        });
+
+        for (int k = 0; k < m; ++k) {
+            slotSum[baseA + k] = mergedSum[order[k]];
+            slotHead[baseA + k] = mergedHead[order[k]];
+            slotTail[baseA + k] = mergedTail[order[k]];
+        }
+        spreads.push({slotSum[baseA] - slotSum[baseA + m - 1], a});
+    }
+
+    int last = spreads.top().second;
+    size_t base = static_cast<size_t>(last) * m;
+    for (int k = 0; k < m; ++k) {
+        for (int job = slotHead[base + k]; job >= 0; job = nextJob[job]) {
+            taskAssignments[job] = k + 1;
+        }
+    }
+    return static_cast<int>(slotSum[base]);
+}
@@ -0,0 +1,15 @@
+#ifndef LARGEST_DIFFERENCING_H
+#define LARGEST_DIFFERENCING_H
+
+#include <vector>
+
+// Karmarkar-Karp largest differencing for m-way partitioning. Every task
+// starts as an m-tuple of subset sums (p, 0, ..., 0); the two tuples with the
+// largest max-min spread are merged largest-with-smallest until one tuple is
+// left, whose subsets are the machines. Tuples live in one pool sized up
+// front, merges are written in place, and each subset is a linked list of
+// tasks, so a merge costs O(m log m) with no allocation. Writes the 1-based
+// machine of each task and returns Cmax.
+int largestDifferencing(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments);
+
+#endif
@@ -0,0 +1,112 @@
+#include "list_schedule.h"
+#include "machine_load_tracker.h"
+#include <utility>
+using namespace std;
+
+typedef int (*ListScheduleKernel)(const int*, int, int*);
+
+// The index packs below expand to straight-line code, one step per machine,
+// and every load is only touched at a constant index so the array can stay
+// in registers.
+template <int... I>
+static inline int leastLoadedFixed(const int* loads, integer_sequence<int, I...>) {
+    int best = 0;
+    int bestLoad = loads[0];
+    ((loads[I] < bestLoad ? (best = I, bestLoad = loads[I]) : 0), ...);
+    return best;
+}
+
+template <int... I>
+static inline void assignFixed(int* loads, int machine, int duration, integer_sequence<int, I...>) {
+    ((loads[I] += (I == machine) ? duration : 0), ...);
+}
+
+template <int... I>
+static inline int maxLoadFixed(const int* loads, integer_sequence<int, I...>) {
+    int Cmax = loads[0];
+    ((Cmax = loads[I] > Cmax ? loads[I] : Cmax), ...);
+    return Cmax;
+}
+
+template <int M>
+static int listScheduleFixed(const int* tasks, int count, int* taskAssignments) {
+    const auto machines = make_integer_sequence<int, M>();
+    int loads[M] = {};
+
+    for (int i = 0; i < count; ++i) {
+        int minMachine = leastLoadedFixed(loads, machines);
+        assignFixed(loads, minMachine, tasks[i], machines);
+        taskAssignments[i] = minMachine + 1;
+    }
+
+    return maxLoadFixed(loads, machines);
+}
+
+template <int M>
+static int continueScheduleFixed(const int* tasks, int count, const int* initialLoads, int cutoff) {
+    const auto machines = make_integer_sequence<int, M>();
+    int loads[M];
+    for (int i = 0; i < M; ++i) {
+        loads[i] = initialLoads[i];
+    }
+
+    for (int i = 0; i < count; ++i) {
+        int minMachine = leastLoadedFixed(loads, machines);
+        if (loads[minMachine] + tasks[i] >= cutoff) {
+            return cutoff;
+        }
+        assignFixed(loads, minMachine, tasks[i], machines);
+    }
+
+    return maxLoadFixed(loads, machines);
+}
+
+static const ListScheduleKernel fixedKernels[kMaxFixedMachines + 1] = {
+    nullptr,
+    listScheduleFixed<1>, listScheduleFixed<2>, listScheduleFixed<3>, listScheduleFixed<4>,
+    listScheduleFixed<5>, listScheduleFixed<6>, listScheduleFixed<7>, listScheduleFixed<8>,
+    listScheduleFixed<9>, listScheduleFixed<10>
+};
+
+typedef int (*ContinueScheduleKernel)(const int*, int, const int*, int);
+
+static const ContinueScheduleKernel continueKernels[kMaxFixedMachines + 1] = {
+    nullptr,
+    continueScheduleFixed<1>, continueScheduleFixed<2>, continueScheduleFixed<3>, continueScheduleFixed<4>,
+    continueScheduleFixed<5>, continueScheduleFixed<6>, continueScheduleFixed<7>, continueScheduleFixed<8>,
+    continueScheduleFixed<9>, continueScheduleFixed<10>
+};
+
+int listSchedule(const vector<int>& orderedTasks, int numMachines, vector<int>& taskAssignments) {
+    if (numMachines >= 1 && numMachines <= kMaxFixedMachines) {
+        return fixedKernels[numMachines](orderedTasks.data(), static_cast<int>(orderedTasks.size()),
+                                         taskAssignments.data());
+    }
+
+    MachineLoadTracker machines(numMachines);
+    for (size_t i = 0; i < orderedTasks.size(); ++i) {
+        int minMachine = machines.leastLoaded();
+        machines.assign(minMachine, orderedTasks[i]);
+        taskAssignments[i] = minMachine + 1;
+    }
+    return machines.maxLoad();
+}
+
+int continueListSchedule(const int* orderedTasks, int count, int numMachines, const int* loads, int cutoff) {
+    if (numMachines >= 1 && numMachines <= kMaxFixedMachines) {
+        return continueKernels[numMachines](orderedTasks, count, loads, cutoff);
+    }
+
+    MachineLoadTracker machines(numMachines);
+    for (int machine = 0; machine < numMachines; ++machine) {
+        machines.assign(machine, loads[machine]);
+    }
+    for (int i = 0; i < count; ++i) {
+        int minMachine = machines.leastLoaded();
+        if (machines.load(minMachine) + orderedTasks[i] >= cutoff) {
+            return cutoff;
+        }
+        machines.assign(minMachine, orderedTasks[i]);
+    }
+    return machines.maxLoad();
+}
@@ -0,0 +1,23 @@
+#ifndef LIST_SCHEDULE_H
+#define LIST_SCHEDULE_H
+
+#include <vector>
+
+// Machine counts up to this value run a kernel specialized at compile time,
+// which keeps the loads in registers and bypasses the SIMD argmin; larger
+// counts go through MachineLoadTracker and its SIMD argmin. The unrolled scan
+// costs 1-2 ns per machine per job against a flat ~20 ns per vector call,
+// so it is faster up to about ten machines and slower beyond.
+const int kMaxFixedMachines = 10;
+
+// Assigns orderedTasks one by one to the least-loaded machine (lowest index on
+// ties), writes the 1-based machine of each task to taskAssignments and
+// returns Cmax.
+int listSchedule(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments);
+
+// Schedules count tasks the same way onto machines that already carry loads
+// and returns the final Cmax, or cutoff as soon as a task would finish at or
+// after cutoff. Only the loads matter, so no assignments are written.
+int continueListSchedule(const int* orderedTasks, int count, int numMachines, const int* loads, int cutoff);
+
+#endif
@@ -0,0 +1,231 @@
+#ifndef LIST_SCHEDULER_H
+#define LIST_SCHEDULER_H
+
+#include "instance_io.h"
+#include "largest_differencing.h"
+#include "list_schedule.h"
+#include "local_search.h"
+#include "makespan_bounds.h"
+#include "multifit.h"
+#include "schedule_metrics.h"
+#include "task_ordering.h"
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// One list-scheduling engine for every ordering rule. The three policies are
+// plain types resolved at compile time:
+//   OrderPolicy   void order(const std::vector<int>& tasks, std::vector<int>& jobOrder) const
+//                 (writes the input index of every task in list order)
+//   SelectPolicy  int assign(const std::vector<int>& orderedTasks, int numMachines,
+//                            std::vector<int>& taskAssignments) const  (returns Cmax)
+//   OutputPolicy  void write(const Instance& instance, const ScheduleMetrics& metrics,
+//                            double timeTaken, const std::vector<int>& taskAssignments)
+// The metrics are evaluated after the timed selection step.
+template <class OrderPolicy, class SelectPolicy, class OutputPolicy>
+class ListScheduler {
+public:
+    ListScheduler(OrderPolicy orderPolicy, SelectPolicy selectPolicy, OutputPolicy outputPolicy)
+        : orderPolicy(orderPolicy), selectPolicy(selectPolicy), outputPolicy(outputPolicy) {}
+
+    int schedule(const Instance& instance) {
+        orderPolicy.order(instance.tasks, jobOrder);
+        orderedTasks.resize(jobOrder.size());
+        for (size_t i = 0; i < jobOrder.size(); ++i) {
+            orderedTasks[i] = instance.tasks[jobOrder[i]];
+        }
+        taskAssignments.resize(instance.tasks.size());
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        int Cmax = selectPolicy.assign(orderedTasks, instance.numMachines, taskAssignments);
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double timeTaken = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e9;
+        outputPolicy.write(instance, evaluator.evaluate(instance, jobOrder, taskAssignments), timeTaken,
+                           taskAssignments);
+        return Cmax;
+    }
+
+private:
+    OrderPolicy orderPolicy;
+    SelectPolicy selectPolicy;
+    OutputPolicy outputPolicy;
+    ScheduleEvaluator evaluator;
+    std::vector<int> jobOrder;
+    std::vector<int> orderedTasks;
+    std::vector<int> taskAssignments;
+};
+
+template <TaskOrder Order>
+struct SortedOrder {
+    void order(const std::vector<int>& tasks, std::vector<int>& jobOrder) const {
+        jobOrder.resize(tasks.size());
+        std::iota(jobOrder.begin(), jobOrder.end(), 0);
+        orderPositions(tasks, jobOrder.begin(), jobOrder.end(), Order);
+    }
+};
+
+typedef SortedOrder<TaskOrder::Descending> LPTOrder;
+typedef SortedOrder<TaskOrder::Ascending> SPTOrder;
+
+// The first splitRule(n) tasks of the input are ordered by First, the rest by
+// Second, and the two halves are scheduled one after the other.
+template <TaskOrder First, TaskOrder Second, class SplitRule>
+struct SplitOrder {
+    SplitRule splitRule;
+
+    void order(const std::vector<int>& tasks, std::vector<int>& jobOrder) const {
+        int splitPoint = splitRule(static_cast<int>(tasks.size()));
+        jobOrder.resize(tasks.size());
+        std::iota(jobOrder.begin(), jobOrder.end(), 0);
+        orderPositions(tasks, jobOrder.begin(), jobOrder.begin() + splitPoint, First);
+        orderPositions(tasks, jobOrder.begin() + splitPoint, jobOrder.end(), Second);
+    }
+};
+
+struct HalfSplit {
+    int operator()(int numJobs) const { return numJobs / 2; }
+};
+
+typedef SplitOrder<TaskOrder::Descending, TaskOrder::Ascending, HalfSplit> MixedLPTSPTOrder;
+typedef SplitOrder<TaskOrder::Ascending, TaskOrder::Descending, HalfSplit> MixedSPTLPTOrder;
+
+struct PercentageSplit {
+    int percentage;
+
+    int operator()(int numJobs) const {
+        return static_cast<int>(std::round((percentage / 100.0) * numJobs));
+    }
+};
+
+struct LeastLoadedSelect {
+    int assign(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments) const {
+        return listSchedule(orderedTasks, numMachines, taskAssignments);
+    }
+};
+
+// List scheduling followed by the move/swap improvement phase, limited to
+// timeBudget seconds per instance and skipped when the list schedule already
+// meets makespanLowerBound().
+struct LocalSearchSelect {
+    double timeBudget;
+
+    int assign(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments) const {
+        int Cmax = listSchedule(orderedTasks, numMachines, taskAssignments);
+        if (Cmax <= makespanLowerBound(orderedTasks, numMachines)) {
+            return Cmax;
+        }
+        return improveSchedule(orderedTasks, numMachines, taskAssignments, timeBudget);
+    }
+};
+
+// MULTIFIT capacity search; pair it with LPTOrder, since first-fit-decreasing
+// needs the longest tasks first.
+struct MultifitSelect {
+    int assign(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments) const {
+        return multifit(orderedTasks, numMachines, taskAssignments);
+    }
+};
+
+// Karmarkar-Karp differencing; the order only settles ties.
+struct DifferencingSelect {
+    int assign(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments) const {
+        return largestDifferencing(orderedTasks, numMachines, taskAssignments);
+    }
+};
+
+// Writes the summary line "n m class instance Cmax time", extended by
+// "Cmin l2 sumC sumWC" when the schedule's metrics are given, and the
+// assignment line of each instance, both followed by a blank line.
+// Assignments are in list order: entry p is the machine of the job at list
+// position p, and each machine runs its jobs in that order. The ordering rules
+// write the list they scheduled; algorithms with no list of their own (exact,
+// genetic, PTAS, eligibility, precedence) write the LPT list, durations
+// non-increasing and ties in input order, and the online rules write the
+// arrival order, which is the input order.
+struct RecordOutput {
+    std::ofstream& summaryFile;
+    std::ofstream& assignmentsFile;
+
+    void write(const Instance& instance, const ScheduleMetrics& metrics, double timeTaken,
+               const std::vector<int>& taskAssignments) {
+        writeSummary(instance, static_cast<int>(metrics.Cmax), timeTaken);
+        summaryFile << " " << metrics << std::endl << std::endl;
+        writeAssignments(instance, taskAssignments);
+    }
+
+    void write(const Instance& instance, int Cmax, double timeTaken, const std::vector<int>& taskAssignments) {
+        writeSummary(instance, Cmax, timeTaken);
+        summaryFile << std::endl << std::endl;
+        writeAssignments(instance, taskAssignments);
+    }
+
+    void writeSummary(const Instance& instance, int Cmax, double timeTaken) {
+        summaryFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                    << instance.instanceNumber << " " << Cmax << " " << std::fixed << std::setprecision(9)
+                    << timeTaken;
+    }
+
+    void writeAssignments(const Instance& instance, const std::vector<int>& taskAssignments) {
+        assignmentsFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber
+                        << " " << instance.instanceNumber << std::endl;
+        for (int assignment : taskAssignments) {
+            assignmentsFile << assignment << " ";
+        }
+        assignmentsFile << std::endl << std::endl;
+    }
+};
+
+// Rewrites the machine of each input task into the list order of jobOrder
+// (the input index at every list position).
+inline void listOrderAssignments(const std::vector<int>& jobOrder, const std::vector<int>& taskAssignments,
+                                 std::vector<int>& listAssignments) {
+    listAssignments.resize(jobOrder.size());
+    for (size_t p = 0; p < jobOrder.size(); ++p) {
+        listAssignments[p] = taskAssignments[jobOrder[p]];
+    }
+}
+
+// Runs one ordering rule over every instance of inputPath with the given
+// machine selection and writes the usual summary and assignment files.
+template <class OrderPolicy, class SelectPolicy>
+void runOrderingRule(OrderPolicy orderPolicy, SelectPolicy selectPolicy, const std::string& name,
+                     const std::string& inputPath, const std::string& outputPath,
+                     const std::string& assignmentsPath) {
+    std::ifstream inputFile(inputPath);
+    std::ofstream outputFile(outputPath);
+    std::ofstream assignmentsFile(assignmentsPath);
+
+    if (!inputFile || !outputFile || !assignmentsFile) {
+        std::cerr << "Error opening files for " << name << "." << std::endl;
+        return;
+    }
+
+    ListScheduler<OrderPolicy, SelectPolicy, RecordOutput> scheduler(
+        orderPolicy, selectPolicy, RecordOutput{outputFile, assignmentsFile});
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    while (readInstance(inputFile, instance)) {
+        scheduler.schedule(instance);
+    }
+
+    inputFile.close();
+    outputFile.close();
+    assignmentsFile.close();
+}
+
+template <class OrderPolicy>
+void runOrderingRule(OrderPolicy orderPolicy, const std::string& name, const std::string& inputPath,
+                     const std::string& outputPath, const std::string& assignmentsPath) {
+    runOrderingRule(orderPolicy, LeastLoadedSelect(), name, inputPath, outputPath, assignmentsPath);
+}
+
+#endif
@@ -0,0 +1,53 @@
+#include "load_heap.h"
+using namespace std;
+
+LoadHeap::LoadHeap(const vector<long long>& initialLoads)
+    : loads(initialLoads), heap(initialLoads.size()), slot(initialLoads.size()) {
+    for (size_t i = 0; i < loads.size(); ++i) {
+        heap[i] = static_cast<int>(i);
+        slot[i] = static_cast<int>(i);
+    }
+    for (int i = static_cast<int>(heap.size()) / 2 - 1; i >= 0; --i) {
+        siftDown(i);
+    }
+}
+
+void LoadHeap::add(int machine, long long delta) {
+    loads[machine] += delta;
+    if (delta > 0) {
+        siftUp(slot[machine]);
+    } else {
+        siftDown(slot[machine]);
+    }
+}
+
+void LoadHeap::place(int i, int machine) {
+    heap[i] = machine;
+    slot[machine] = i;
+}
+
+void LoadHeap::siftUp(int i) {
+    int machine = heap[i];
+    while (i > 0 && loads[heap[(i - 1) / 2]] < loads[machine]) {
+        place(i, heap[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+    place(i, machine);
+}
+
+void LoadHeap::siftDown(int i) {
+    int machine = heap[i];
+    int count = static_cast<int>(heap.size());
+    while (2 * i + 1 < count) {
+        int child = 2 * i + 1;
+        if (child + 1 < count && loads[heap[child + 1]] > loads[heap[child]]) {
+            child++;
+        }
+        if (loads[heap[child]] <= loads[machine]) {
+            break;
+        }
+        place(i, heap[child]);
+        i = child;
+    }
+    place(i, machine);
+}
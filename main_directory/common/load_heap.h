@@ -0,0 +1,28 @@
+#ifndef LOAD_HEAP_H
+#define LOAD_HEAP_H
+
+#include <vector>
+
+// Machine loads with the machines kept in an indexed max-heap, so the most
+// loaded machine is O(1) and changing one load costs O(log m).
+class LoadHeap {
+public:
+    explicit LoadHeap(const std::vector<long long>& initialLoads);
+
+    long long load(int machine) const { return loads[machine]; }
+    int top() const { return heap[0]; }
+    long long maxLoad() const { return loads[heap[0]]; }
+
+    void add(int machine, long long delta);
+
+private:
+    void place(int i, int machine);
+    void siftUp(int i);
+    void siftDown(int i);
+
+    std::vector<long long> loads;
+    std::vector<int> heap;
+    std::vector<int> slot;
+};
+
+#endif
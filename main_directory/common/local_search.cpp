@@ -0,0 +1,96 @@
+#include "local_search.h"
+#include "load_heap.h"
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+int improveSchedule(const vector<int>& orderedTasks, int numMachines, vector<int>& taskAssignments,
+                    double timeBudget) {
+    vector<long long> loads(numMachines, 0);
+    vector<vector<int>> machineJobs(numMachines);
+    vector<int> slotOf(orderedTasks.size());
+
+    for (size_t j = 0; j < orderedTasks.size(); ++j) {
+        int machine = taskAssignments[j] - 1;
+        loads[machine] += orderedTasks[j];
+        slotOf[j] = static_cast<int>(machineJobs[machine].size());
+        machineJobs[machine].push_back(static_cast<int>(j));
+    }
+
+    LoadHeap heap(loads);
+
+    auto removeJob = [&](int job, int machine) {
+        vector<int>& jobs = machineJobs[machine];
+        int last = jobs.back();
+        jobs[slotOf[job]] = last;
+        slotOf[last] = slotOf[job];
+        jobs.pop_back();
+        heap.add(machine, -orderedTasks[job]);
+    };
+    auto addJob = [&](int job, int machine) {
+        slotOf[job] = static_cast<int>(machineJobs[machine].size());
+        machineJobs[machine].push_back(job);
+        heap.add(machine, orderedTasks[job]);
+        taskAssignments[job] = machine + 1;
+    };
+
+    auto start = chrono::steady_clock::now();
+
+    for (long long step = 0;; ++step) {
+        if (step % 64 == 0 && chrono::duration<double>(chrono::steady_clock::now() - start).count() > timeBudget) {
+            break;
+        }
+
+        int critical = heap.top();
+        long long Cmax = heap.load(critical);
+
+        // Best step so far: the larger of the two new loads, which has to
+        // stay below Cmax for the step to count.
+        long long bestPeak = Cmax;
+        int bestJob = -1, bestMachine = -1, bestPartner = -1;
+
+        for (int job : machineJobs[critical]) {
+            int duration = orderedTasks[job];
+            for (int machine = 0; machine < numMachines; ++machine) {
+                if (machine == critical) {
+                    continue;
+                }
+
+                long long peak = max(Cmax - duration, heap.load(machine) + duration);
+                if (peak < bestPeak) {
+                    bestPeak = peak;
+                    bestJob = job;
+                    bestMachine = machine;
+                    bestPartner = -1;
+                }
+
+                for (int partner : machineJobs[machine]) {
+                    int delta = duration - orderedTasks[partner];
+                    if (delta <= 0) {
+                        continue;
+                    }
+                    peak = max(Cmax - delta, heap.load(machine) + delta);
+                    if (peak < bestPeak) {
+                        bestPeak = peak;
+                        bestJob = job;
+                        bestMachine = machine;
+                        bestPartner = partner;
+                    }
+                }
+            }
+        }
+
+        if (bestJob < 0) {
+            break;
+        }
+
+        removeJob(bestJob, critical);
+        if (bestPartner >= 0) {
+            removeJob(bestPartner, bestMachine);
+            addJob(bestPartner, critical);
+        }
+        addJob(bestJob, bestMachine);
+    }
+
+    return static_cast<int>(heap.maxLoad());
+}
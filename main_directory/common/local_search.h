@@ -0,0 +1,16 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <vector>
+
+// Improves a finished schedule of orderedTasks (1-based taskAssignments, as
+// written by listSchedule) in place and returns the new Cmax. Each step takes
+// the most loaded machine from a max-heap and applies the best move of one of
+// its jobs, or swap with a shorter job, that lowers its load without lifting
+// the other machine to it. Every candidate is scored in O(1) from the two
+// loads and each applied step costs O(log m). Stops at a local optimum or
+// after timeBudget seconds.
+int improveSchedule(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments,
+                    double timeBudget);
+
+#endif
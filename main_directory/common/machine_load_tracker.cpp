@@ -0,0 +1,57 @@
+#include "machine_load_tracker.h"
+#include "simd_argmin.h"
+#include <algorithm>
+#include <limits>
+using namespace std;
+
+MachineLoadTracker::MachineLoadTracker(int numMachines)
+    : machineCount(numMachines), leafCount(1),
+      useTree(numMachines > kScanMachineLimit), totalLoad(0) {
+    while (leafCount < numMachines) {
+        leafCount *= 2;
+    }
+    int paddedCount = max(leafCount, kArgminPadding);
+
+    // Padding entries carry an unreachable load so they never win a match.
+    machineTimes.assign(paddedCount, numeric_limits<int>::max());
+    fill(machineTimes.begin(), machineTimes.begin() + numMachines, 0);
+
+    if (!useTree) {
+        return;
+    }
+
+    tree.assign(2 * leafCount, 0);
+    for (int i = 0; i < leafCount; ++i) {
+        tree[leafCount + i] = i;
+    }
+    for (int node = leafCount - 1; node >= 1; --node) {
+        int left = tree[2 * node];
+        int right = tree[2 * node + 1];
+        tree[node] = machineTimes[left] <= machineTimes[right] ? left : right;
+    }
+}
+
+int MachineLoadTracker::leastLoaded() const {
+    if (useTree) {
+        return tree[1];
+    }
+    return argminLoad(machineTimes.data(), static_cast<int>(machineTimes.size()), totalLoad < 65535);
+}
+
+void MachineLoadTracker::assign(int machine, int duration) {
+    machineTimes[machine] += duration;
+    totalLoad += duration;
+
+    if (!useTree) {
+        return;
+    }
+    for (int node = (leafCount + machine) / 2; node >= 1; node /= 2) {
+        int left = tree[2 * node];
+        int right = tree[2 * node + 1];
+        tree[node] = machineTimes[left] <= machineTimes[right] ? left : right;
+    }
+}
+
+int MachineLoadTracker::maxLoad() const {
+    return *max_element(machineTimes.begin(), machineTimes.begin() + machineCount);
+}
@@ -0,0 +1,34 @@
+#ifndef MACHINE_LOAD_TRACKER_H
+#define MACHINE_LOAD_TRACKER_H
+
+#include <vector>
+
+// Keeps the current load of every machine and answers "which machine is least
+// loaded". Up to kScanMachineLimit machines the loads are scanned with the
+// SIMD argmin kernel; beyond that they live in an implicit tournament tree, so
+// the answer is O(1) and each assignment costs O(log m). Either way ties
+// resolve to the lowest machine index, the same machine min_element over the
+// load vector would return.
+class MachineLoadTracker {
+public:
+    static const int kScanMachineLimit = 32;
+
+    explicit MachineLoadTracker(int numMachines);
+
+    int leastLoaded() const;
+    void assign(int machine, int duration);
+
+    int load(int machine) const { return machineTimes[machine]; }
+    int maxLoad() const;
+    int numMachines() const { return machineCount; }
+
+private:
+    int machineCount;
+    int leafCount;
+    bool useTree;
+    long long totalLoad;
+    std::vector<int> machineTimes;
+    std::vector<int> tree;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "makespan_bounds.h"
+#include "task_ordering.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BOUNDS_X86 1
+#endif
+
+using namespace std;
+
+typedef void (*SumMaxKernel)(const int*, size_t, long long&, int&);
+
+static void sumMaxScalar(const int* tasks, size_t count, long long& total, int& longest) {
+    total = 0;
+    longest = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += tasks[i];
+        longest = max(longest, tasks[i]);
+    }
+}
+
+#ifdef BOUNDS_X86
+
+// Eight durations per step: the running max stays in 32-bit lanes, the sum is
+// widened to four 64-bit lanes so it cannot overflow.
+__attribute__((target("avx2")))
+static void sumMaxAvx2(const int* tasks, size_t count, long long& total, int& longest) {
+    __m256i sums = _mm256_setzero_si256();
+    __m256i maxima = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tasks + i));
+        maxima = _mm256_max_epi32(maxima, chunk);
+        sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(chunk)));
+        sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(chunk, 1)));
+    }
+
+    long long sumLanes[4];
+    int maxLanes[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(sumLanes), sums);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(maxLanes), maxima);
+    total = sumLanes[0] + sumLanes[1] + sumLanes[2] + sumLanes[3];
+    longest = *max_element(maxLanes, maxLanes + 8);
+    for (; i < count; ++i) {
+        total += tasks[i];
+        longest = max(longest, tasks[i]);
+    }
+}
+
+#endif
+
+static SumMaxKernel selectSumMaxKernel() {
+#ifdef BOUNDS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return sumMaxAvx2;
+    }
+#endif
+    return sumMaxScalar;
+}
+
+static const SumMaxKernel sumMax = selectSumMaxKernel();
+
+long long makespanLowerBound(const vector<int>& tasks, int numMachines) {
+    if (tasks.empty() || numMachines <= 0) {
+        return 0;
+    }
+
+    long long total;
+    int longest;
+    sumMax(tasks.data(), tasks.size(), total, longest);
+    long long bound = max((total + numMachines - 1) / numMachines, static_cast<long long>(longest));
+
+    long long numJobs = static_cast<long long>(tasks.size());
+    if (numJobs <= numMachines) {
+        return bound;
+    }
+
+    vector<int> sortedTasks = tasks;
+    orderTasks(sortedTasks.begin(), sortedTasks.end(), TaskOrder::Descending);
+
+    vector<long long> prefixSum(numJobs + 1, 0);
+    for (long long i = 0; i < numJobs; ++i) {
+        prefixSum[i + 1] = prefixSum[i] + sortedTasks[i];
+    }
+
+    // Among the k*m + 1 longest jobs some machine runs at least k + 1.
+    for (long long k = 1; k * numMachines + 1 <= numJobs; ++k) {
+        long long last = k * numMachines;
+        bound = max(bound, prefixSum[last + 1] - prefixSum[last - k]);
+    }
+    return bound;
+}
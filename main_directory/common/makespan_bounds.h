@@ -0,0 +1,13 @@
+#ifndef MAKESPAN_BOUNDS_H
+#define MAKESPAN_BOUNDS_H
+
+#include <vector>
+
+// Lower bound on the optimal Cmax of P||Cmax: the largest of ceil(sum / m),
+// p_max and, for every k with k*m + 1 <= n, the sum of the k + 1 shortest of
+// the k*m + 1 longest jobs (k = 1 is the classic p_m + p_(m+1)). A heuristic
+// that reaches this value is optimal. The sum and p_max come from one pass,
+// eight durations at a time on AVX2 machines.
+long long makespanLowerBound(const std::vector<int>& tasks, int numMachines);
+
+#endif
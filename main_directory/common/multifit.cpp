@@ -0,0 +1,94 @@
+#include "multifit.h"
+#include "makespan_bounds.h"
+#include <algorithm>
+#include <climits>
+using namespace std;
+
+FirstFitPacker::FirstFitPacker(int numBins) : binCount(numBins), leafCount(1) {
+    while (leafCount < numBins) {
+        leafCount *= 2;
+    }
+    tree.assign(2 * leafCount, -1);
+}
+
+void FirstFitPacker::update(int bin, int remaining) {
+    int node = leafCount + bin;
+    tree[node] = remaining;
+    for (node /= 2; node >= 1; node /= 2) {
+        tree[node] = max(tree[2 * node], tree[2 * node + 1]);
+    }
+}
+
+bool FirstFitPacker::pack(const vector<int>& tasks, int capacity, vector<int>& taskAssignments) {
+    // Padding leaves stay at -1 so they never fit a job.
+    fill(tree.begin(), tree.end(), -1);
+    for (int bin = 0; bin < binCount; ++bin) {
+        tree[leafCount + bin] = capacity;
+    }
+    for (int node = leafCount - 1; node >= 1; --node) {
+        tree[node] = max(tree[2 * node], tree[2 * node + 1]);
+    }
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (tree[1] < tasks[i]) {
+            return false;
+        }
+
+        int node = 1;
+        while (node < leafCount) {
+            node = tree[2 * node] >= tasks[i] ? 2 * node : 2 * node + 1;
+        }
+
+        int bin = node - leafCount;
+        update(bin, tree[node] - tasks[i]);
+        taskAssignments[i] = bin + 1;
+    }
+    return true;
+}
+
+int multifit(const vector<int>& orderedTasks, int numMachines, vector<int>& taskAssignments) {
+    long long totalLoad = 0;
+    int longest = 0;
+    for (int duration : orderedTasks) {
+        totalLoad += duration;
+        longest = max(longest, duration);
+    }
+
+    FirstFitPacker packer(numMachines);
+    vector<int> candidate(orderedTasks.size());
+
+    // A packing within makespanLowerBound() is optimal, so that capacity is
+    // tried before the search.
+    long long lowerBound = makespanLowerBound(orderedTasks, numMachines);
+    if (lowerBound <= INT_MAX && packer.pack(orderedTasks, static_cast<int>(lowerBound), candidate)) {
+        taskAssignments = candidate;
+        return static_cast<int>(lowerBound);
+    }
+
+    // FFD always fits into max(2 * sum / m, p_max); the search widens the
+    // upper end if rounding ever makes that fail.
+    long long low = max<long long>((totalLoad + numMachines - 1) / numMachines, longest);
+    long long high = max<long long>((2 * totalLoad + numMachines - 1) / numMachines, longest);
+    high = min<long long>(high, INT_MAX);
+    while (!packer.pack(orderedTasks, static_cast<int>(high), candidate)) {
+        low = high + 1;
+        high = min<long long>(2 * high, INT_MAX);
+    }
+    taskAssignments = candidate;
+
+    while (low < high) {
+        long long capacity = low + (high - low) / 2;
+        if (packer.pack(orderedTasks, static_cast<int>(capacity), candidate)) {
+            high = capacity;
+            taskAssignments = candidate;
+        } else {
+            low = capacity + 1;
+        }
+    }
+
+    vector<long long> loads(numMachines, 0);
+    for (size_t i = 0; i < orderedTasks.size(); ++i) {
+        loads[taskAssignments[i] - 1] += orderedTasks[i];
+    }
+    return static_cast<int>(*max_element(loads.begin(), loads.end()));
+}
@@ -0,0 +1,32 @@
+#ifndef MULTIFIT_H
+#define MULTIFIT_H
+
+#include <vector>
+
+// First-fit bin packing over numBins bins of equal capacity. The remaining
+// capacities sit in a max segment tree, so the leftmost bin that still fits a
+// job is found in O(log m) and a whole packing costs O(n log m).
+class FirstFitPacker {
+public:
+    explicit FirstFitPacker(int numBins);
+
+    // Packs tasks in the given order and writes the 1-based bin of each task.
+    // Returns false as soon as a task fits in no bin.
+    bool pack(const std::vector<int>& tasks, int capacity, std::vector<int>& taskAssignments);
+
+private:
+    void update(int bin, int remaining);
+
+    int binCount;
+    int leafCount;
+    std::vector<int> tree;
+};
+
+// MULTIFIT: binary search on the common capacity of the machines with a
+// first-fit-decreasing packing at every step, after one packing at
+// makespanLowerBound() that ends the search if it fits. orderedTasks must be
+// sorted longest first. Writes the 1-based machine of each task and returns
+// Cmax.
+int multifit(const std::vector<int>& orderedTasks, int numMachines, std::vector<int>& taskAssignments);
+
+#endif
@@ -0,0 +1,133 @@
+#include "online_scheduler.h"
+#include <algorithm>
+#include <functional>
+using namespace std;
+
+const double kAlbersRatio = 1.923;
+const double kAlbersAlpha = (kAlbersRatio - 1) / 2;
+const double kAlbersLightShare = 0.29;
+const size_t kStreamBufferSize = 1 << 16;
+
+void RootMinHeap::push(pair<long long, int> entry) {
+    heap.push_back(entry);
+    push_heap(heap.begin(), heap.end(), greater<pair<long long, int>>());
+}
+
+void RootMinHeap::replaceTop(pair<long long, int> entry) {
+    size_t count = heap.size();
+    size_t i = 0;
+    while (2 * i + 1 < count) {
+        size_t child = 2 * i + 1;
+        if (child + 1 < count && heap[child + 1] < heap[child]) {
+            child++;
+        }
+        if (!(heap[child] < entry)) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = entry;
+}
+
+OnlineScheduler::OnlineScheduler(int numMachines, OnlineRule rule)
+    : machineCount(numMachines), rule(rule), maxLoad(0), totalLoad(0), jobCount(0),
+      lightMachines(static_cast<int>(kAlbersLightShare * numMachines)), lightLoad(0) {
+    if (lightMachines == 0) {
+        this->rule = OnlineRule::Graham;
+    }
+    if (this->rule == OnlineRule::Graham) {
+        lightMachines = numMachines;
+    }
+    for (int machine = 0; machine < numMachines; ++machine) {
+        if (machine < lightMachines) {
+            light.push({0, machine});
+        } else {
+            heavy.push({0, machine});
+        }
+    }
+}
+
+int OnlineScheduler::assign(int duration) {
+    int machine = rule == OnlineRule::Albers ? assignAlbers(duration) : assignGraham(duration);
+    totalLoad += duration;
+    jobCount++;
+    return machine;
+}
+
+int OnlineScheduler::assignGraham(int duration) {
+    pair<long long, int> entry = light.top();
+    entry.first += duration;
+    light.replaceTop(entry);
+    maxLoad = max(maxLoad, entry.first);
+    return entry.second;
+}
+
+int OnlineScheduler::assignAlbers(int duration) {
+    // L_l <= alpha * L_h compares the average light and heavy loads.
+    long long heavyLoad = totalLoad - lightLoad;
+    bool lightEnough = static_cast<double>(lightLoad) * (machineCount - lightMachines) <=
+                       kAlbersAlpha * static_cast<double>(heavyLoad) * lightMachines;
+    double average = static_cast<double>(totalLoad + duration) / machineCount;
+    bool overloads = heavy.top().first + duration > kAlbersRatio * average;
+
+    if (!lightEnough && !overloads) {
+        pair<long long, int> entry = heavy.top();
+        entry.first += duration;
+        heavy.replaceTop(entry);
+        maxLoad = max(maxLoad, entry.first);
+        return entry.second;
+    }
+
+    // A light machine that outgrows the lightest heavy one trades places
+    // with it.
+    pair<long long, int> entry = light.top();
+    long long previousLoad = entry.first;
+    entry.first += duration;
+    if (entry.first <= heavy.top().first) {
+        light.replaceTop(entry);
+        lightLoad += duration;
+    } else {
+        pair<long long, int> promoted = heavy.top();
+        heavy.replaceTop(entry);
+        light.replaceTop(promoted);
+        lightLoad += promoted.first - previousLoad;
+    }
+    maxLoad = max(maxLoad, entry.first);
+    return entry.second;
+}
+
+JobStreamReader::JobStreamReader(istream& input)
+    : input(input), buffer(kStreamBufferSize), position(0), size(0) {}
+
+bool JobStreamReader::refill() {
+    input.read(buffer.data(), buffer.size());
+    size = static_cast<size_t>(input.gcount());
+    position = 0;
+    return size > 0;
+}
+
+bool JobStreamReader::next(int& duration) {
+    while (true) {
+        if (position == size && !refill()) {
+            return false;
+        }
+        char c = buffer[position];
+        if (c >= '0' && c <= '9') {
+            break;
+        }
+        position++;
+    }
+
+    int value = 0;
+    while (position < size || refill()) {
+        char c = buffer[position];
+        if (c < '0' || c > '9') {
+            break;
+        }
+        value = value * 10 + (c - '0');
+        position++;
+    }
+    duration = value;
+    return true;
+}
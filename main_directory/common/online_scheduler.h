@@ -0,0 +1,79 @@
+#ifndef ONLINE_SCHEDULER_H
+#define ONLINE_SCHEDULER_H
+
+#include <istream>
+#include <utility>
+#include <vector>
+
+// How an arriving job picks its machine.
+//   Graham  the least-loaded machine, (2 - 1/m)-competitive.
+//   Albers  Albers' 1.923-competitive rule: keep about 29% of the machines
+//           lightly loaded and send a job to the least-loaded of the others
+//           while that stays within 1.923 times the average load; falls back
+//           to Graham below four machines.
+enum class OnlineRule { Graham, Albers };
+
+// Min-heap of (load, machine) whose only update is replacing the root, which
+// is all the online rules need: the job goes to a minimum and loads only grow.
+class RootMinHeap {
+public:
+    void push(std::pair<long long, int> entry);
+    const std::pair<long long, int>& top() const { return heap[0]; }
+    void replaceTop(std::pair<long long, int> entry);
+
+private:
+    std::vector<std::pair<long long, int>> heap;
+};
+
+// Assigns jobs the moment they arrive, keeping only per-machine state, so
+// memory is O(m) however long the job stream is. Every assignment is
+// O(log m).
+class OnlineScheduler {
+public:
+    OnlineScheduler(int numMachines, OnlineRule rule);
+
+    // Places the job and returns its 0-based machine.
+    int assign(int duration);
+
+    long long Cmax() const { return maxLoad; }
+    long long jobsScheduled() const { return jobCount; }
+
+private:
+    int assignGraham(int duration);
+    int assignAlbers(int duration);
+
+    int machineCount;
+    OnlineRule rule;
+    long long maxLoad;
+    long long totalLoad;
+    long long jobCount;
+
+    // Graham keeps every machine in light. Albers splits the machines into
+    // the lightMachines lightest (light, whose loads total lightLoad) and the
+    // rest (heavy); no light load exceeds a heavy one, so the root of heavy is
+    // the (lightMachines + 1)-th least-loaded machine.
+    RootMinHeap light;
+    RootMinHeap heavy;
+    int lightMachines;
+    long long lightLoad;
+};
+
+// Reads whitespace-separated job durations through a fixed-size buffer, so
+// streams of any length are parsed without holding them in memory.
+class JobStreamReader {
+public:
+    explicit JobStreamReader(std::istream& input);
+
+    // False once the stream holds no further number.
+    bool next(int& duration);
+
+private:
+    bool refill();
+
+    std::istream& input;
+    std::vector<char> buffer;
+    size_t position;
+    size_t size;
+};
+
+#endif
@@ -0,0 +1,161 @@
+#include "parallel_tempering.h"
+#include "load_heap.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+using namespace std;
+
+// Moves each replica makes between two rounds of replica exchange.
+const int kMovesPerEpoch = 2000;
+
+struct Replica {
+    vector<int> machineOf;
+    LoadHeap heap;
+    double temperature;
+    mt19937 rng;
+
+    long long bestCmax;
+    vector<int> bestMachineOf;
+    double bestTime;
+};
+
+static void anneal(Replica& replica, const vector<int>& durations, int numMachines, long long targetCmax,
+                   chrono::steady_clock::time_point start, long long& moves) {
+    int numJobs = static_cast<int>(durations.size());
+    uniform_int_distribution<int> pickJob(0, numJobs - 1);
+    uniform_int_distribution<int> pickMachine(0, numMachines - 2);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+
+    long long energy = replica.heap.maxLoad();
+
+    for (int move = 0; move < kMovesPerEpoch && replica.bestCmax > targetCmax; ++move) {
+        int job = pickJob(replica.rng);
+        int from = replica.machineOf[job];
+        int partner = -1;
+        int to;
+
+        if (unit(replica.rng) < 0.5) {
+            to = pickMachine(replica.rng);
+            to += to >= from;
+        } else {
+            partner = pickJob(replica.rng);
+            to = replica.machineOf[partner];
+            if (to == from || durations[partner] == durations[job]) {
+                continue;
+            }
+        }
+
+        long long shift = durations[job] - (partner >= 0 ? durations[partner] : 0);
+        replica.heap.add(from, -shift);
+        replica.heap.add(to, shift);
+        long long delta = replica.heap.maxLoad() - energy;
+        moves++;
+
+        if (delta > 0 && unit(replica.rng) >= exp(-delta / replica.temperature)) {
+            replica.heap.add(to, -shift);
+            replica.heap.add(from, shift);
+            continue;
+        }
+
+        replica.machineOf[job] = to;
+        if (partner >= 0) {
+            replica.machineOf[partner] = from;
+        }
+        energy += delta;
+
+        if (energy < replica.bestCmax) {
+            replica.bestCmax = energy;
+            replica.bestMachineOf = replica.machineOf;
+            replica.bestTime = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        }
+    }
+}
+
+AnnealingResult parallelTempering(const vector<int>& orderedTasks, int numMachines, vector<int>& taskAssignments,
+                                  double timeBudget, int numReplicas, long long targetCmax) {
+    auto start = chrono::steady_clock::now();
+    int numJobs = static_cast<int>(orderedTasks.size());
+
+    vector<int> machineOf(numJobs);
+    vector<long long> loads(numMachines, 0);
+    long long totalLoad = 0;
+    for (int j = 0; j < numJobs; ++j) {
+        machineOf[j] = taskAssignments[j] - 1;
+        loads[machineOf[j]] += orderedTasks[j];
+        totalLoad += orderedTasks[j];
+    }
+
+    LoadHeap seed(loads);
+    AnnealingResult result = {static_cast<int>(seed.maxLoad()), 0.0, 0};
+    if (numJobs < 2 || numMachines < 2 || numReplicas < 1 || seed.maxLoad() <= targetCmax) {
+        return result;
+    }
+
+    // Temperatures from half a mean task length down to half a time unit.
+    double hottest = max(1.0, 0.5 * totalLoad / numJobs);
+    double coldest = 0.5;
+    vector<Replica> replicas;
+    for (int r = 0; r < numReplicas; ++r) {
+        double fraction = numReplicas > 1 ? static_cast<double>(r) / (numReplicas - 1) : 0.0;
+        double temperature = coldest * pow(hottest / coldest, fraction);
+        replicas.push_back({machineOf, seed, temperature, mt19937(5489u + r), seed.maxLoad(), machineOf, 0.0});
+    }
+
+    vector<long long> moves(numReplicas, 0);
+    mt19937 exchangeRng(12345u);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+
+    auto elapsed = [&]() { return chrono::duration<double>(chrono::steady_clock::now() - start).count(); };
+    auto reachedTarget = [&]() {
+        for (const Replica& replica : replicas) {
+            if (replica.bestCmax <= targetCmax) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    while (elapsed() < timeBudget && !reachedTarget()) {
+        vector<thread> threads;
+        for (int r = 0; r < numReplicas; ++r) {
+            threads.emplace_back(anneal, ref(replicas[r]), cref(orderedTasks), numMachines, targetCmax, start,
+                                 ref(moves[r]));
+        }
+        for (thread& t : threads) {
+            t.join();
+        }
+
+        // Replicas are ordered coldest first; swap neighbouring states with
+        // the usual Metropolis criterion.
+        for (int r = 0; r + 1 < numReplicas; ++r) {
+            Replica& cold = replicas[r];
+            Replica& hot = replicas[r + 1];
+            double exponent = (cold.heap.maxLoad() - hot.heap.maxLoad()) *
+                              (1.0 / cold.temperature - 1.0 / hot.temperature);
+            if (exponent >= 0 || unit(exchangeRng) < exp(exponent)) {
+                swap(cold.machineOf, hot.machineOf);
+                swap(cold.heap, hot.heap);
+            }
+        }
+    }
+
+    const Replica* best = &replicas[0];
+    for (const Replica& replica : replicas) {
+        if (replica.bestCmax < best->bestCmax ||
+            (replica.bestCmax == best->bestCmax && replica.bestTime < best->bestTime)) {
+            best = &replica;
+        }
+    }
+
+    for (int j = 0; j < numJobs; ++j) {
+        taskAssignments[j] = best->bestMachineOf[j] + 1;
+    }
+    result.Cmax = static_cast<int>(best->bestCmax);
+    result.timeToBest = best->bestTime;
+    for (long long count : moves) {
+        result.moves += count;
+    }
+    return result;
+}
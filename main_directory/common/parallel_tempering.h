@@ -0,0 +1,24 @@
+#ifndef PARALLEL_TEMPERING_H
+#define PARALLEL_TEMPERING_H
+
+#include <vector>
+
+struct AnnealingResult {
+    int Cmax;
+    double timeToBest;
+    long long moves;
+};
+
+// Parallel-tempering simulated annealing. numReplicas copies of the schedule
+// in taskAssignments (1-based, e.g. from listSchedule) anneal on their own
+// threads at geometrically spaced temperatures, and neighbouring temperatures
+// exchange states between epochs. A move relocates one task or swaps two;
+// every replica keeps its loads in a LoadHeap, so applying or undoing a move
+// and reading the new Cmax costs O(log m). Runs for timeBudget seconds, or
+// until targetCmax is reached, and leaves the best schedule found in
+// taskAssignments. timeToBest is measured from the call.
+AnnealingResult parallelTempering(const std::vector<int>& orderedTasks, int numMachines,
+                                  std::vector<int>& taskAssignments, double timeBudget, int numReplicas,
+                                  long long targetCmax);
+
+#endif
@@ -0,0 +1,147 @@
+#include "precedence_scheduler.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+using namespace std;
+
+PrecedenceGraph buildPrecedenceGraph(int numJobs, const vector<pair<int, int>>& edges) {
+    PrecedenceGraph graph;
+    graph.offsets.assign(numJobs + 1, 0);
+    graph.indegree.assign(numJobs, 0);
+
+    auto inRange = [numJobs](const pair<int, int>& edge) {
+        return edge.first >= 0 && edge.first < numJobs && edge.second >= 0 && edge.second < numJobs;
+    };
+    for (const pair<int, int>& edge : edges) {
+        if (inRange(edge)) {
+            graph.offsets[edge.first + 1]++;
+            graph.indegree[edge.second]++;
+        }
+    }
+    for (int job = 0; job < numJobs; ++job) {
+        graph.offsets[job + 1] += graph.offsets[job];
+    }
+
+    graph.targets.resize(graph.offsets[numJobs]);
+    vector<int> next(graph.offsets.begin(), graph.offsets.end() - 1);
+    for (const pair<int, int>& edge : edges) {
+        if (inRange(edge)) {
+            graph.targets[next[edge.first]++] = edge.second;
+        }
+    }
+    return graph;
+}
+
+// Longest chain of durations from each job to a sink, or an empty vector if
+// the graph has a cycle.
+static vector<long long> criticalPaths(const vector<int>& tasks, const PrecedenceGraph& graph) {
+    int numJobs = static_cast<int>(tasks.size());
+    vector<int> indegree = graph.indegree;
+    vector<int> topological;
+    topological.reserve(numJobs);
+
+    for (int job = 0; job < numJobs; ++job) {
+        if (indegree[job] == 0) {
+            topological.push_back(job);
+        }
+    }
+    for (size_t i = 0; i < topological.size(); ++i) {
+        int job = topological[i];
+        for (int e = graph.offsets[job]; e < graph.offsets[job + 1]; ++e) {
+            if (--indegree[graph.targets[e]] == 0) {
+                topological.push_back(graph.targets[e]);
+            }
+        }
+    }
+    if (static_cast<int>(topological.size()) != numJobs) {
+        return {};
+    }
+
+    vector<long long> length(numJobs, 0);
+    for (auto it = topological.rbegin(); it != topological.rend(); ++it) {
+        long long tail = 0;
+        for (int e = graph.offsets[*it]; e < graph.offsets[*it + 1]; ++e) {
+            tail = max(tail, length[graph.targets[e]]);
+        }
+        length[*it] = tasks[*it] + tail;
+    }
+    return length;
+}
+
+long long precedenceListSchedule(const vector<int>& tasks, int numMachines, const PrecedenceGraph& graph,
+                                 ReadyPriority priority, vector<int>& taskAssignments,
+                                 vector<long long>& completionTimes) {
+    int numJobs = static_cast<int>(tasks.size());
+    taskAssignments.assign(numJobs, 0);
+    completionTimes.assign(numJobs, 0);
+
+    vector<long long> rank(numJobs);
+    if (priority == ReadyPriority::CriticalPath) {
+        rank = criticalPaths(tasks, graph);
+        if (rank.empty() && numJobs > 0) {
+            return -1;
+        }
+    } else {
+        for (int job = 0; job < numJobs; ++job) {
+            rank[job] = priority == ReadyPriority::Longest ? tasks[job] : -static_cast<long long>(tasks[job]);
+        }
+    }
+
+    // Highest rank first, lowest index among equals.
+    auto readyOrder = [&](int a, int b) { return rank[a] != rank[b] ? rank[a] < rank[b] : a > b; };
+    priority_queue<int, vector<int>, decltype(readyOrder)> ready(readyOrder);
+
+    typedef pair<long long, int> Event;
+    priority_queue<Event, vector<Event>, greater<Event>> freeMachines;
+    priority_queue<Event, vector<Event>, greater<Event>> running;
+
+    vector<int> indegree = graph.indegree;
+    for (int job = 0; job < numJobs; ++job) {
+        if (indegree[job] == 0) {
+            ready.push(job);
+        }
+    }
+    for (int machine = 0; machine < numMachines; ++machine) {
+        freeMachines.push({0, machine});
+    }
+
+    long long now = 0;
+    long long Cmax = 0;
+    int started = 0;
+
+    while (started < numJobs) {
+        while (!running.empty() && running.top().first <= now) {
+            int job = running.top().second;
+            running.pop();
+            for (int e = graph.offsets[job]; e < graph.offsets[job + 1]; ++e) {
+                if (--indegree[graph.targets[e]] == 0) {
+                    ready.push(graph.targets[e]);
+                }
+            }
+        }
+
+        while (!ready.empty() && freeMachines.top().first <= now) {
+            int machine = freeMachines.top().second;
+            freeMachines.pop();
+            int job = ready.top();
+            ready.pop();
+
+            long long finish = now + tasks[job];
+            taskAssignments[job] = machine + 1;
+            completionTimes[job] = finish;
+            freeMachines.push({finish, machine});
+            running.push({finish, job});
+            Cmax = max(Cmax, finish);
+            started++;
+        }
+
+        if (started == numJobs) {
+            break;
+        }
+        if (running.empty()) {
+            return -1;
+        }
+        now = max(now, running.top().first);
+    }
+    return Cmax;
+}
@@ -0,0 +1,32 @@
+#ifndef PRECEDENCE_SCHEDULER_H
+#define PRECEDENCE_SCHEDULER_H
+
+#include <utility>
+#include <vector>
+
+// Successor lists of a precedence DAG in CSR form: the successors of job j
+// are targets[offsets[j] .. offsets[j + 1]).
+struct PrecedenceGraph {
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<int> indegree;
+};
+
+// Pairs naming a job outside 0..numJobs-1 are dropped.
+PrecedenceGraph buildPrecedenceGraph(int numJobs, const std::vector<std::pair<int, int>>& edges);
+
+// Which ready job a free machine takes first.
+enum class ReadyPriority { Longest, Shortest, CriticalPath };
+
+// Non-delay list scheduling for P|prec|Cmax. Jobs whose predecessors have all
+// finished wait in a ready heap ordered by priority (critical path = the
+// longest duration chain from the job to a sink); machines wait in a heap
+// keyed by the time they become free (lowest index on ties), and running jobs
+// in a heap of finish times. Every job and edge is handled once, so the whole
+// run is O((n + e) log n). Writes the 1-based machine and the completion time
+// of each input task and returns Cmax, or -1 if the edges contain a cycle.
+long long precedenceListSchedule(const std::vector<int>& tasks, int numMachines, const PrecedenceGraph& graph,
+                                 ReadyPriority priority, std::vector<int>& taskAssignments,
+                                 std::vector<long long>& completionTimes);
+
+#endif
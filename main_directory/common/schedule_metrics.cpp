@@ -0,0 +1,87 @@
+#include "schedule_metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+using namespace std;
+
+ostream& operator<<(ostream& output, const ScheduleMetrics& metrics) {
+    return output << metrics.Cmin << " " << fixed << setprecision(3) << metrics.loadDeviation << " "
+                  << metrics.totalCompletion << " " << metrics.weightedCompletion;
+}
+
+const ScheduleMetrics& ScheduleEvaluator::evaluate(const Instance& instance, const vector<int>& taskAssignments) {
+    return evaluateList(instance, nullptr, taskAssignments);
+}
+
+const ScheduleMetrics& ScheduleEvaluator::evaluate(const Instance& instance, const vector<int>& jobOrder,
+                                                   const vector<int>& taskAssignments) {
+    return evaluateList(instance, jobOrder.data(), taskAssignments);
+}
+
+const ScheduleMetrics& ScheduleEvaluator::evaluate(const Instance& instance, const vector<int>& taskAssignments,
+                                                   const vector<long long>& completionTimes) {
+    const vector<int>& tasks = instance.tasks;
+    const int* weights = instance.weights.empty() ? nullptr : instance.weights.data();
+    loads.assign(instance.numMachines, 0);
+
+    long long Cmax = 0;
+    long long totalCompletion = 0;
+    long long weightedCompletion = 0;
+    for (size_t job = 0; job < tasks.size(); ++job) {
+        loads[taskAssignments[job] - 1] += tasks[job];
+        Cmax = max(Cmax, completionTimes[job]);
+        totalCompletion += completionTimes[job];
+        weightedCompletion += (weights ? weights[job] : 1) * completionTimes[job];
+    }
+    reduceLoads(Cmax);
+    metrics.totalCompletion = totalCompletion;
+    metrics.weightedCompletion = weightedCompletion;
+    return metrics;
+}
+
+const ScheduleMetrics& ScheduleEvaluator::evaluateList(const Instance& instance, const int* jobOrder,
+                                                       const vector<int>& taskAssignments) {
+    const vector<int>& tasks = instance.tasks;
+    const int* weights = instance.weights.empty() ? nullptr : instance.weights.data();
+    size_t numJobs = tasks.size();
+    loads.assign(instance.numMachines, 0);
+
+    // A job completes when its machine's running load reaches it.
+    long long totalCompletion = 0;
+    long long weightedCompletion = 0;
+    for (size_t p = 0; p < numJobs; ++p) {
+        int job = jobOrder ? jobOrder[p] : static_cast<int>(p);
+        long long completion = loads[taskAssignments[p] - 1] += tasks[job];
+        totalCompletion += completion;
+        weightedCompletion += (weights ? weights[job] : 1) * completion;
+    }
+    reduceLoads(-1);
+    metrics.totalCompletion = totalCompletion;
+    metrics.weightedCompletion = weightedCompletion;
+    return metrics;
+}
+
+void ScheduleEvaluator::reduceLoads(long long Cmax) {
+    // Independent reductions over a contiguous array, which the compiler
+    // turns into vector min/max/add.
+    int numMachines = static_cast<int>(loads.size());
+    const long long* load = loads.data();
+    long long maxLoad = 0;
+    long long minLoad = numMachines > 0 ? load[0] : 0;
+    long long totalLoad = 0;
+    for (int i = 0; i < numMachines; ++i) {
+        maxLoad = max(maxLoad, load[i]);
+        minLoad = min(minLoad, load[i]);
+        totalLoad += load[i];
+    }
+    double mean = numMachines > 0 ? static_cast<double>(totalLoad) / numMachines : 0;
+    double squaredDeviation = 0;
+    for (int i = 0; i < numMachines; ++i) {
+        double deviation = load[i] - mean;
+        squaredDeviation += deviation * deviation;
+    }
+
+    metrics.Cmax = Cmax < 0 ? maxLoad : Cmax;
+    metrics.Cmin = minLoad;
+    metrics.loadDeviation = numMachines > 0 ? sqrt(squaredDeviation / numMachines) : 0;
+}
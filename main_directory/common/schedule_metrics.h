@@ -0,0 +1,62 @@
+#ifndef SCHEDULE_METRICS_H
+#define SCHEDULE_METRICS_H
+
+#include "instance_io.h"
+#include <ostream>
+#include <vector>
+
+// Objectives of one identical-machine schedule. Every machine runs its jobs
+// in the order the schedule placed them, without idle time unless the
+// completion times are given.
+struct ScheduleMetrics {
+    long long Cmax;
+    // Machine covering: the smallest machine load.
+    long long Cmin;
+    // l2 load imbalance: root mean square deviation of the loads from their
+    // mean, zero for a perfectly balanced schedule.
+    double loadDeviation;
+    // Sum of completion times C_j, plain and weighted by the instance weights
+    // (unit weights when the instance has none).
+    long long totalCompletion;
+    long long weightedCompletion;
+};
+
+// Writes "Cmin l2 sumC sumWC", the columns that follow the usual summary
+// fields.
+std::ostream& operator<<(std::ostream& output, const ScheduleMetrics& metrics);
+
+// Computes every ScheduleMetrics field in one pass over the list plus one
+// reduction over the machine loads. Buffers are kept between calls, so
+// evaluating a stream of instances does not allocate once they stop growing.
+class ScheduleEvaluator {
+public:
+    // taskAssignments is the 1-based machine of each task of instance.tasks,
+    // which is also the list.
+    const ScheduleMetrics& evaluate(const Instance& instance, const std::vector<int>& taskAssignments);
+
+    // jobOrder is the list as input indices (what the order policies and
+    // SplitSweep::splitPositions() produce) and taskAssignments the 1-based
+    // machine of each list position.
+    const ScheduleMetrics& evaluate(const Instance& instance, const std::vector<int>& jobOrder,
+                                    const std::vector<int>& taskAssignments);
+
+    // For schedules with idle time, such as under precedence constraints:
+    // completionTimes[j] is when task j finishes on machine taskAssignments[j],
+    // both in input order. Cmax is the latest completion, while Cmin and l2
+    // measure the busy time of each machine.
+    const ScheduleMetrics& evaluate(const Instance& instance, const std::vector<int>& taskAssignments,
+                                    const std::vector<long long>& completionTimes);
+
+private:
+    // A null jobOrder lists the jobs in input order.
+    const ScheduleMetrics& evaluateList(const Instance& instance, const int* jobOrder,
+                                        const std::vector<int>& taskAssignments);
+
+    // Fills Cmin and l2 from loads, and Cmax unless it is already known.
+    void reduceLoads(long long Cmax);
+
+    ScheduleMetrics metrics;
+    std::vector<long long> loads;
+};
+
+#endif
@@ -0,0 +1,199 @@
+#include "simd_argmin.h"
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARGMIN_X86 1
+#endif
+
+using namespace std;
+
+typedef int (*ArgminKernel)(const int*, int);
+typedef int (*EligibleArgminKernel)(const int*, int, uint64_t);
+
+static int argminScalar(const int* loads, int count) {
+    int best = 0;
+    for (int i = 1; i < count; ++i) {
+        if (loads[i] < loads[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+static int argminEligibleScalar(const int* loads, int count, uint64_t eligible) {
+    int best = -1;
+    for (int i = 0; i < count; ++i) {
+        if ((eligible >> i & 1) && (best < 0 || loads[i] < loads[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+#ifdef ARGMIN_X86
+
+// Packs eight loads to unsigned 16-bit lanes and lets phminposuw report the
+// minimum and its lowest lane. Padding saturates to 65535, which is never
+// below a real load on this path.
+__attribute__((target("sse4.1")))
+static int argminSse41(const int* loads, int count) {
+    int bestValue = INT_MAX;
+    int bestIndex = 0;
+    for (int base = 0; base < count; base += 8) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(loads + base));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(loads + base + 4));
+        __m128i result = _mm_minpos_epu16(_mm_packus_epi32(low, high));
+        int value = _mm_extract_epi16(result, 0);
+        if (value < bestValue) {
+            bestValue = value;
+            bestIndex = base + _mm_extract_epi16(result, 1);
+        }
+    }
+    return bestIndex;
+}
+
+__attribute__((target("avx2")))
+static int argminAvx2(const int* loads, int count) {
+    __m256i best = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(loads));
+    for (int base = 8; base < count; base += 8) {
+        best = _mm256_min_epi32(best, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(loads + base)));
+    }
+
+    __m128i reduced = _mm_min_epi32(_mm256_castsi256_si128(best), _mm256_extracti128_si256(best, 1));
+    reduced = _mm_min_epi32(reduced, _mm_shuffle_epi32(reduced, _MM_SHUFFLE(1, 0, 3, 2)));
+    reduced = _mm_min_epi32(reduced, _mm_shuffle_epi32(reduced, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m256i target = _mm256_broadcastd_epi32(reduced);
+
+    for (int base = 0; base < count; base += 8) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(loads + base));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, target)));
+        if (mask != 0) {
+            return base + __builtin_ctz(mask);
+        }
+    }
+    return 0;
+}
+
+// Uses the masked forms with an explicit source throughout; the unmasked
+// intrinsics trip GCC's uninitialized warnings on their undefined passthrough.
+__attribute__((target("avx512f")))
+static int argminAvx512(const int* loads, int count) {
+    const __mmask16 all = 0xFFFF;
+    __m512i best = _mm512_loadu_si512(loads);
+    for (int base = 16; base < count; base += 16) {
+        best = _mm512_mask_min_epi32(best, all, best, _mm512_loadu_si512(loads + base));
+    }
+
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_i32x4(best, all, best, best, _MM_SHUFFLE(1, 0, 3, 2)));
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_i32x4(best, all, best, best, _MM_SHUFFLE(2, 3, 0, 1)));
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_epi32(best, all, best, _MM_PERM_BADC));
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_epi32(best, all, best, _MM_PERM_CDAB));
+
+    for (int base = 0; base < count; base += 16) {
+        __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(loads + base), best);
+        if (mask != 0) {
+            return base + __builtin_ctz(mask);
+        }
+    }
+    return 0;
+}
+
+// Eight lanes at a time: the mask byte is broadcast, tested against one bit
+// per lane and the ineligible lanes are blended to INT_MAX.
+__attribute__((target("avx2")))
+static int argminEligibleAvx2(const int* loads, int count, uint64_t eligible) {
+    const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i ceiling = _mm256_set1_epi32(INT_MAX);
+
+    __m256i best = ceiling;
+    for (int base = 0; base < count; base += 8) {
+        __m256i bits = _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(eligible >> base & 0xFF)), laneBits);
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(loads + base));
+        chunk = _mm256_blendv_epi8(ceiling, chunk, _mm256_cmpeq_epi32(bits, laneBits));
+        best = _mm256_min_epi32(best, chunk);
+    }
+
+    __m128i reduced = _mm_min_epi32(_mm256_castsi256_si128(best), _mm256_extracti128_si256(best, 1));
+    reduced = _mm_min_epi32(reduced, _mm_shuffle_epi32(reduced, _MM_SHUFFLE(1, 0, 3, 2)));
+    reduced = _mm_min_epi32(reduced, _mm_shuffle_epi32(reduced, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m256i target = _mm256_broadcastd_epi32(reduced);
+
+    for (int base = 0; base < count; base += 8) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(loads + base));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, target)));
+        mask &= static_cast<int>(eligible >> base & 0xFF);
+        if (mask != 0) {
+            return base + __builtin_ctz(mask);
+        }
+    }
+    return -1;
+}
+
+// Sixteen bits of the eligibility mask are a mask register as they are, so
+// ineligible lanes simply keep INT_MAX through the masked min.
+__attribute__((target("avx512f")))
+static int argminEligibleAvx512(const int* loads, int count, uint64_t eligible) {
+    const __mmask16 all = 0xFFFF;
+    __m512i best = _mm512_set1_epi32(INT_MAX);
+    for (int base = 0; base < count; base += 16) {
+        __mmask16 lanes = static_cast<__mmask16>(eligible >> base);
+        best = _mm512_mask_min_epi32(best, lanes, best, _mm512_loadu_si512(loads + base));
+    }
+
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_i32x4(best, all, best, best, _MM_SHUFFLE(1, 0, 3, 2)));
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_i32x4(best, all, best, best, _MM_SHUFFLE(2, 3, 0, 1)));
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_epi32(best, all, best, _MM_PERM_BADC));
+    best = _mm512_mask_min_epi32(best, all, best, _mm512_mask_shuffle_epi32(best, all, best, _MM_PERM_CDAB));
+
+    for (int base = 0; base < count; base += 16) {
+        __mmask16 lanes = static_cast<__mmask16>(eligible >> base);
+        __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(lanes, _mm512_loadu_si512(loads + base), best);
+        if (mask != 0) {
+            return base + __builtin_ctz(mask);
+        }
+    }
+    return -1;
+}
+
+#endif
+
+struct ArgminDispatch {
+    ArgminKernel kernel16;
+    ArgminKernel kernel32;
+    EligibleArgminKernel eligible;
+};
+
+static ArgminDispatch selectArgminKernels() {
+    ArgminDispatch dispatch = {argminScalar, argminScalar, argminEligibleScalar};
+#ifdef ARGMIN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        dispatch.kernel32 = argminAvx512;
+        dispatch.eligible = argminEligibleAvx512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        dispatch.kernel32 = argminAvx2;
+        dispatch.eligible = argminEligibleAvx2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        dispatch.kernel16 = argminSse41;
+    } else {
+        dispatch.kernel16 = dispatch.kernel32;
+    }
+#endif
+    return dispatch;
+}
+
+static const ArgminDispatch activeKernels = selectArgminKernels();
+
+int argminLoad(const int* loads, int paddedCount, bool fitsIn16Bits) {
+    return fitsIn16Bits ? activeKernels.kernel16(loads, paddedCount)
+                        : activeKernels.kernel32(loads, paddedCount);
+}
+
+int argminEligibleLoad(const int* loads, int paddedCount, uint64_t eligible) {
+    if (paddedCount < kMaxMaskedMachines) {
+        eligible &= (uint64_t(1) << paddedCount) - 1;
+    }
+    return eligible == 0 ? -1 : activeKernels.eligible(loads, paddedCount, eligible);
+}
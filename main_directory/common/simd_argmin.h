@@ -0,0 +1,31 @@
+#ifndef SIMD_ARGMIN_H
+#define SIMD_ARGMIN_H
+
+#include <cstdint>
+
+// Callers pad the load array to a multiple of this many entries and fill the
+// padding with INT_MAX, so every kernel can use full-width vector loads.
+const int kArgminPadding = 16;
+
+// Index of the first minimum of loads[0..paddedCount), the same element
+// min_element would return. When fitsIn16Bits is set every real load must be
+// below 65535, which enables the SSE4.1 phminposuw kernel; otherwise the best
+// 32-bit kernel the CPU supports (AVX-512, AVX2 or scalar) is used.
+// listSchedule() runs its own register-resident kernels up to
+// kMaxFixedMachines, where they are faster, so on that path this serves
+// kMaxFixedMachines < m <= 32; the MachineLoadTracker users (local search,
+// split sweeps, breakpoint search) and the unrelated-machines scheduler use
+// it for every small m.
+int argminLoad(const int* loads, int paddedCount, bool fitsIn16Bits);
+
+// Machine counts up to this value can describe eligibility as one bitmask.
+const int kMaxMaskedMachines = 64;
+
+// Index of the first minimum of loads[0..paddedCount) among the entries whose
+// bit is set in eligible, or -1 if none is. paddedCount is at most
+// kMaxMaskedMachines and padding entries must not be eligible. Ineligible
+// lanes are replaced by INT_MAX in registers, with AVX-512 mask registers or
+// AVX2 blends, before the usual reduction.
+int argminEligibleLoad(const int* loads, int paddedCount, uint64_t eligible);
+
+#endif
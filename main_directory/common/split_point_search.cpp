@@ -0,0 +1,115 @@
+#include "split_point_search.h"
+#include "histogram_scheduler.h"
+#include "list_schedule.h"
+#include "makespan_bounds.h"
+#include "split_sweep.h"
+#include <algorithm>
+#include <limits>
+using namespace std;
+
+SplitPointResult findBestSplitPoint(const vector<int>& tasks, int numMachines) {
+    SplitPointResult result = {0, 0, 0};
+    if (tasks.empty() || numMachines <= 0) {
+        return result;
+    }
+
+    vector<DurationRun> runs = buildHistogram(tasks.begin(), tasks.end());
+    vector<int> durations(runs.size());
+    for (size_t r = 0; r < runs.size(); ++r) {
+        durations[r] = runs[r].duration;
+    }
+
+    vector<int> rankOf(tasks.size());
+    long long totalLoad = 0;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        rankOf[i] = lower_bound(durations.begin(), durations.end(), tasks[i]) - durations.begin();
+        totalLoad += tasks[i];
+    }
+    long long lowerBound = makespanLowerBound(tasks, numMachines);
+
+    int numRuns = static_cast<int>(runs.size());
+    int numJobs = static_cast<int>(tasks.size());
+    result.Cmax = numeric_limits<long long>::max();
+
+    // Mostly distinct durations leave nothing to batch, so those instances
+    // are scheduled job by job from orderings derived from a single sort, as
+    // long as the loads fit the int kernels.
+    if (static_cast<long long>(numRuns) * kMinJobsPerRun > numJobs && totalLoad <= numeric_limits<int>::max()) {
+        SplitSweep sweep;
+        sweep.reset(tasks);
+        vector<int> orderedTasks;
+        vector<int> loads(numMachines);
+
+        for (int split = 0; split <= numJobs; ++split) {
+            sweep.orderSplit(split, orderedTasks);
+            result.splitsEvaluated++;
+
+            // Least-loaded assignment deals an ascending list out round robin,
+            // as far as the multiset of loads goes, so the SPT prefix leaves
+            // stride sums of the sorted prefix and needs no argmin.
+            fill(loads.begin(), loads.end(), 0);
+            for (int i = 0, machine = 0; i < split; ++i) {
+                loads[machine] += orderedTasks[i];
+                machine = machine + 1 == numMachines ? 0 : machine + 1;
+            }
+
+            // The heaviest stride sum is the one ending at the longest prefix
+            // task, and it never shrinks as the prefix grows, so once it
+            // reaches the best Cmax no later split can beat it.
+            int prefixMax = *max_element(loads.begin(), loads.end());
+            if (prefixMax >= result.Cmax) {
+                break;
+            }
+
+            // The LPT suffix stops as soon as a task would finish at or past
+            // the best Cmax.
+            int cutoff = static_cast<int>(min<long long>(result.Cmax, numeric_limits<int>::max()));
+            int Cmax = continueListSchedule(orderedTasks.data() + split, numJobs - split, numMachines, loads.data(),
+                                            cutoff);
+            if (Cmax < result.Cmax) {
+                result.Cmax = Cmax;
+                result.bestSplit = split;
+                if (result.Cmax <= lowerBound) {
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    vector<long long> prefixCount(numRuns, 0);
+    HistogramScheduler machines(numMachines);
+
+    for (int split = 0; split <= numJobs; ++split) {
+        if (split > 0) {
+            prefixCount[rankOf[split - 1]]++;
+        }
+
+        machines.reset();
+        bool pruned = false;
+        for (int r = 0; r < numRuns && !pruned; ++r) {
+            if (prefixCount[r] > 0) {
+                machines.assignRun(durations[r], prefixCount[r]);
+                pruned = machines.maxLoad() >= result.Cmax;
+            }
+        }
+        for (int r = numRuns - 1; r >= 0 && !pruned; --r) {
+            long long suffixCount = runs[r].count - prefixCount[r];
+            if (suffixCount > 0) {
+                machines.assignRun(durations[r], suffixCount);
+                pruned = machines.maxLoad() >= result.Cmax;
+            }
+        }
+        result.splitsEvaluated++;
+
+        if (!pruned) {
+            result.Cmax = machines.maxLoad();
+            result.bestSplit = split;
+            if (result.Cmax <= lowerBound) {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
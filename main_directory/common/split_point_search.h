@@ -0,0 +1,31 @@
+#ifndef SPLIT_POINT_SEARCH_H
+#define SPLIT_POINT_SEARCH_H
+
+#include <vector>
+
+struct SplitPointResult {
+    int bestSplit;
+    long long Cmax;
+    int splitsEvaluated;
+};
+
+// Below this many jobs per distinct duration the sweep schedules job lists
+// instead of histogram runs.
+const int kMinJobsPerRun = 4;
+
+// Evaluates the SPT -> LPT hybrid at every split point k = 0..n (the first k
+// input tasks ascending, the rest descending) and returns the smallest k with
+// the lowest Cmax. When durations repeat, the prefix and suffix are kept as
+// duration histograms that move one job per step, and each split is scheduled
+// run by run with the high-multiplicity engine, stopping once its running
+// Cmax reaches the best one found. Mostly distinct durations are scheduled
+// job by job: the SPT prefix is dealt round robin, which gives the same loads
+// as least-loaded assignment, in O(k) additions, and only the LPT suffix runs
+// through continueListSchedule(), which stops once a task would finish at or
+// past the best Cmax. The heaviest prefix load never decreases with k, so the
+// sweep ends as soon as it reaches the best Cmax, or once that best meets
+// makespanLowerBound(). The worst case is still O(n^2) additions for the
+// prefixes plus O(n^2 log m) steps for the suffixes.
+SplitPointResult findBestSplitPoint(const std::vector<int>& tasks, int numMachines);
+
+#endif
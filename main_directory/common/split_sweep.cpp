@@ -0,0 +1,68 @@
+#include "split_sweep.h"
+#include "task_ordering.h"
+#include <algorithm>
+using namespace std;
+
+void SplitSweep::reset(const vector<int>& tasks) {
+    durations = tasks;
+    sortedPositions.resize(tasks.size());
+    if (tasks.empty()) {
+        return;
+    }
+
+    auto bounds = minmax_element(tasks.begin(), tasks.end());
+    int minValue = *bounds.first;
+    long long range = static_cast<long long>(*bounds.second) - minValue + 1;
+
+    if (!prefersCountingSort(static_cast<long long>(tasks.size()), range)) {
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            sortedPositions[i] = static_cast<int>(i);
+        }
+        stable_sort(sortedPositions.begin(), sortedPositions.end(),
+                    [&](int a, int b) { return tasks[a] < tasks[b]; });
+        return;
+    }
+
+    vector<int> bucketStart(range + 1, 0);
+    for (int task : tasks) {
+        bucketStart[task - minValue + 1]++;
+    }
+    for (long long value = 0; value < range; ++value) {
+        bucketStart[value + 1] += bucketStart[value];
+    }
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        sortedPositions[bucketStart[tasks[i] - minValue]++] = static_cast<int>(i);
+    }
+}
+
+void SplitSweep::orderSplit(int splitPoint, vector<int>& orderedTasks) const {
+    orderedTasks.resize(durations.size());
+
+    int out = 0;
+    for (int position : sortedPositions) {
+        if (position < splitPoint) {
+            orderedTasks[out++] = durations[position];
+        }
+    }
+    for (auto it = sortedPositions.rbegin(); it != sortedPositions.rend(); ++it) {
+        if (*it >= splitPoint) {
+            orderedTasks[out++] = durations[*it];
+        }
+    }
+}
+
+void SplitSweep::splitPositions(int splitPoint, vector<int>& positions) const {
+    positions.resize(durations.size());
+
+    int out = 0;
+    for (int position : sortedPositions) {
+        if (position < splitPoint) {
+            positions[out++] = position;
+        }
+    }
+    for (auto it = sortedPositions.rbegin(); it != sortedPositions.rend(); ++it) {
+        if (*it >= splitPoint) {
+            positions[out++] = *it;
+        }
+    }
+}
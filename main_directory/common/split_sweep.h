@@ -0,0 +1,25 @@
+#ifndef SPLIT_SWEEP_H
+#define SPLIT_SWEEP_H
+
+#include <vector>
+
+// Sorts an instance once and derives the ordering of any split point from that
+// single sort: the first splitPoint input tasks ascending (SPT), followed by
+// the remaining tasks descending (LPT). Each derived ordering is a stable
+// filter of the presorted positions, so it costs O(n) instead of a fresh sort.
+class SplitSweep {
+public:
+    void reset(const std::vector<int>& tasks);
+    void orderSplit(int splitPoint, std::vector<int>& orderedTasks) const;
+
+    // Input indices of the tasks in the order orderSplit() lists them.
+    void splitPositions(int splitPoint, std::vector<int>& positions) const;
+
+    int numJobs() const { return static_cast<int>(durations.size()); }
+
+private:
+    std::vector<int> durations;
+    std::vector<int> sortedPositions;
+};
+
+#endif
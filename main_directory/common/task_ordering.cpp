@@ -0,0 +1,81 @@
+#include "task_ordering.h"
+#include <algorithm>
+#include <functional>
+using namespace std;
+
+bool prefersCountingSort(long long count, long long range) {
+    return count >= kCountingSortMinCount && range <= kCountingSortMaxRange && range <= 4 * count;
+}
+
+void orderTasks(vector<int>::iterator first, vector<int>::iterator last, TaskOrder order) {
+    long long count = last - first;
+    if (count < 2) {
+        return;
+    }
+
+    auto bounds = minmax_element(first, last);
+    int minValue = *bounds.first;
+    long long range = static_cast<long long>(*bounds.second) - minValue + 1;
+
+    if (!prefersCountingSort(count, range)) {
+        if (order == TaskOrder::Ascending) {
+            sort(first, last);
+        } else {
+            sort(first, last, greater<int>());
+        }
+        return;
+    }
+
+    vector<int> counts(range, 0);
+    for (auto it = first; it != last; ++it) {
+        counts[*it - minValue]++;
+    }
+
+    auto out = first;
+    if (order == TaskOrder::Ascending) {
+        for (int value = 0; value < range; ++value) {
+            out = fill_n(out, counts[value], minValue + value);
+        }
+    } else {
+        for (int value = static_cast<int>(range) - 1; value >= 0; --value) {
+            out = fill_n(out, counts[value], minValue + value);
+        }
+    }
+}
+
+void orderPositions(const vector<int>& tasks, vector<int>::iterator first, vector<int>::iterator last,
+                    TaskOrder order) {
+    long long count = last - first;
+    if (count < 2) {
+        return;
+    }
+
+    auto byDuration = [&](int a, int b) { return tasks[a] < tasks[b]; };
+    int minValue = tasks[*min_element(first, last, byDuration)];
+    long long range = static_cast<long long>(tasks[*max_element(first, last, byDuration)]) - minValue + 1;
+
+    if (!prefersCountingSort(count, range)) {
+        if (order == TaskOrder::Ascending) {
+            stable_sort(first, last, byDuration);
+        } else {
+            stable_sort(first, last, [&](int a, int b) { return tasks[a] > tasks[b]; });
+        }
+        return;
+    }
+
+    // Stable counting sort: every duration gets the slot range its rank
+    // gives, and positions are dealt into it in their current order.
+    vector<int> starts(range + 1, 0);
+    for (auto it = first; it != last; ++it) {
+        int key = tasks[*it] - minValue;
+        starts[(order == TaskOrder::Ascending ? key : range - 1 - key) + 1]++;
+    }
+    for (long long key = 0; key < range; ++key) {
+        starts[key + 1] += starts[key];
+    }
+    vector<int> positions(first, last);
+    for (int position : positions) {
+        int key = tasks[position] - minValue;
+        first[starts[order == TaskOrder::Ascending ? key : range - 1 - key]++] = position;
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef TASK_ORDERING_H
+#define TASK_ORDERING_H
+
+#include <vector>
+
+enum class TaskOrder { Ascending, Descending };
+
+// Counting sort is used once a range holds at least this many tasks and its
+// values span at most kCountingSortMaxRange distinct durations (and no more
+// than four per task); anything else goes through std::sort.
+const int kCountingSortMinCount = 64;
+const int kCountingSortMaxRange = 1 << 16;
+
+// Whether count durations spanning range values are cheaper to counting sort.
+bool prefersCountingSort(long long count, long long range);
+
+// Sorts [first, last) in place: ascending gives the SPT order, descending the
+// LPT order. Bounded durations are sorted in O(n + range).
+void orderTasks(std::vector<int>::iterator first, std::vector<int>::iterator last, TaskOrder order);
+
+// Sorts the input positions in [first, last) by their durations in tasks, the
+// same way, keeping equal durations in position order, so the list still
+// names the job at every step.
+void orderPositions(const std::vector<int>& tasks, std::vector<int>::iterator first,
+                    std::vector<int>::iterator last, TaskOrder order);
+
+#endif
@@ -0,0 +1,56 @@
+#include "two_machine_partition.h"
+#include <cstdint>
+using namespace std;
+
+int solveTwoMachines(const vector<int>& tasks, vector<int>& taskAssignments) {
+    long long totalLoad = 0;
+    for (int duration : tasks) {
+        totalLoad += duration;
+    }
+
+    long long half = totalLoad / 2;
+    size_t wordCount = static_cast<size_t>(half / 64 + 1);
+    vector<uint64_t> reachable(wordCount, 0);
+    vector<int> firstTask(half + 1, -1);
+    reachable[0] = 1;
+
+    for (size_t task = 0; task < tasks.size(); ++task) {
+        long long duration = tasks[task];
+        if (duration > half) {
+            continue;
+        }
+
+        size_t wordShift = static_cast<size_t>(duration / 64);
+        int bitShift = static_cast<int>(duration % 64);
+
+        // reachable |= reachable << duration, high words first so every
+        // source word is read before it is overwritten.
+        for (size_t w = wordCount; w-- > wordShift;) {
+            uint64_t shifted = reachable[w - wordShift] << bitShift;
+            if (bitShift > 0 && w > wordShift) {
+                shifted |= reachable[w - wordShift - 1] >> (64 - bitShift);
+            }
+
+            uint64_t added = shifted & ~reachable[w];
+            reachable[w] |= shifted;
+            while (added) {
+                long long sum = static_cast<long long>(w) * 64 + __builtin_ctzll(added);
+                if (sum <= half) {
+                    firstTask[sum] = static_cast<int>(task);
+                }
+                added &= added - 1;
+            }
+        }
+    }
+
+    long long best = half;
+    while (!((reachable[best / 64] >> (best % 64)) & 1)) {
+        best--;
+    }
+
+    taskAssignments.assign(tasks.size(), 2);
+    for (long long sum = best; sum > 0; sum -= tasks[firstTask[sum]]) {
+        taskAssignments[firstTask[sum]] = 1;
+    }
+    return static_cast<int>(totalLoad - best);
+}
@@ -0,0 +1,18 @@
+#ifndef TWO_MACHINE_PARTITION_H
+#define TWO_MACHINE_PARTITION_H
+
+#include <vector>
+
+// Instances whose total load exceeds this are left to the general search.
+// The solver below keeps total / 2 bits of reachable sums plus one int per
+// sum, about 2 * total bytes: 32 MiB at this cap.
+const long long kMaxPartitionLoad = 1LL << 24;
+
+// Exact P2||Cmax as a partition problem. The reachable subset sums up to half
+// the total load are a bitset updated by one word-parallel shift-or per task;
+// for every sum the task that first reached it is kept, which is enough to
+// walk the best subset back out. O(n * total / 128) time. Writes the 1-based
+// machine of each task and returns the optimal Cmax.
+int solveTwoMachines(const std::vector<int>& tasks, std::vector<int>& taskAssignments);
+
+#endif
@@ -0,0 +1,51 @@
+#include "uniform_machines.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+using namespace std;
+
+UniformMachines::UniformMachines(const vector<double>& speeds) : numMachines(static_cast<int>(speeds.size())) {
+    map<double, vector<int>> bySpeed;
+    for (int machine = 0; machine < numMachines; ++machine) {
+        bySpeed[speeds[machine]].push_back(machine);
+    }
+    for (auto it = bySpeed.rbegin(); it != bySpeed.rend(); ++it) {
+        classes.push_back({it->first, it->second});
+    }
+}
+
+bool UniformMachines::validSpeeds(const vector<double>& speeds) {
+    return all_of(speeds.begin(), speeds.end(), [](double speed) { return speed > 0 && isfinite(speed); });
+}
+
+double UniformMachines::schedule(const vector<int>& orderedTasks, vector<int>& taskAssignments) {
+    vector<MachineLoadTracker> trackers;
+    for (const SpeedClass& speedClass : classes) {
+        trackers.emplace_back(static_cast<int>(speedClass.machines.size()));
+    }
+
+    for (size_t i = 0; i < orderedTasks.size(); ++i) {
+        int bestClass = -1, bestLocal = -1;
+        double bestFinish = 0;
+
+        for (size_t c = 0; c < classes.size(); ++c) {
+            int local = trackers[c].leastLoaded();
+            double finish = (static_cast<double>(trackers[c].load(local)) + orderedTasks[i]) / classes[c].speed;
+            if (bestClass < 0 || finish < bestFinish ||
+                (finish == bestFinish && classes[c].machines[local] < classes[bestClass].machines[bestLocal])) {
+                bestClass = static_cast<int>(c);
+                bestLocal = local;
+                bestFinish = finish;
+            }
+        }
+
+        trackers[bestClass].assign(bestLocal, orderedTasks[i]);
+        taskAssignments[i] = classes[bestClass].machines[bestLocal] + 1;
+    }
+
+    double Cmax = 0;
+    for (size_t c = 0; c < classes.size(); ++c) {
+        Cmax = max(Cmax, trackers[c].maxLoad() / classes[c].speed);
+    }
+    return Cmax;
+}
@@ -0,0 +1,35 @@
+#ifndef UNIFORM_MACHINES_H
+#define UNIFORM_MACHINES_H
+
+#include "machine_load_tracker.h"
+#include <vector>
+
+// List scheduling on uniform machines (Q||Cmax): a task of length p finishes
+// at (load + p) / speed on a machine, and goes to the machine where that is
+// smallest (lowest index on ties). Machines of equal speed share a
+// MachineLoadTracker, since among them the least loaded always wins, so each
+// task costs one lookup per distinct speed instead of a scan of all m.
+class UniformMachines {
+public:
+    // Every speed must be positive; see validSpeeds().
+    explicit UniformMachines(const std::vector<double>& speeds);
+
+    // True if every speed is a positive finite number, so finish times can
+    // be divided out.
+    static bool validSpeeds(const std::vector<double>& speeds);
+
+    // Schedules orderedTasks from empty machines, writes the 1-based machine
+    // of each task and returns Cmax = max(load / speed).
+    double schedule(const std::vector<int>& orderedTasks, std::vector<int>& taskAssignments);
+
+private:
+    struct SpeedClass {
+        double speed;
+        std::vector<int> machines;
+    };
+
+    int numMachines;
+    std::vector<SpeedClass> classes;
+};
+
+#endif
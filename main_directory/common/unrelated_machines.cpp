@@ -0,0 +1,76 @@
+#include "unrelated_machines.h"
+#include "simd_argmin.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+using namespace std;
+
+ProcessingTimeMatrix::ProcessingTimeMatrix(const vector<int>& durations, int numMachines,
+                                           const vector<int>& jobMajorTimes)
+    : jobCount(static_cast<int>(durations.size())), machineCount(numMachines), longestTime(0) {
+    rowStride = (numMachines + kArgminPadding - 1) / kArgminPadding * kArgminPadding;
+    times.assign(static_cast<size_t>(jobCount) * rowStride, 0);
+
+    for (int job = 0; job < jobCount; ++job) {
+        int* out = &times[static_cast<size_t>(job) * rowStride];
+        for (int machine = 0; machine < numMachines; ++machine) {
+            out[machine] = jobMajorTimes.empty() ? durations[job]
+                                                 : jobMajorTimes[static_cast<size_t>(job) * numMachines + machine];
+            longestTime = max(longestTime, out[machine]);
+        }
+    }
+}
+
+vector<int> orderJobs(const ProcessingTimeMatrix& matrix, JobKey key, int splitPoint, TaskOrder first,
+                      TaskOrder second) {
+    int numJobs = matrix.numJobs();
+    int numMachines = matrix.numMachines();
+
+    // The mean is compared as the row sum, which orders jobs the same way.
+    vector<long long> keys(numJobs);
+    for (int job = 0; job < numJobs; ++job) {
+        const int* row = matrix.row(job);
+        keys[job] = key == JobKey::MinTime ? *min_element(row, row + numMachines)
+                                           : accumulate(row, row + numMachines, 0LL);
+    }
+
+    vector<int> jobOrder(numJobs);
+    iota(jobOrder.begin(), jobOrder.end(), 0);
+    auto sortPart = [&](vector<int>::iterator begin, vector<int>::iterator end, TaskOrder order) {
+        if (order == TaskOrder::Ascending) {
+            stable_sort(begin, end, [&](int a, int b) { return keys[a] < keys[b]; });
+        } else {
+            stable_sort(begin, end, [&](int a, int b) { return keys[a] > keys[b]; });
+        }
+    };
+    sortPart(jobOrder.begin(), jobOrder.begin() + splitPoint, first);
+    sortPart(jobOrder.begin() + splitPoint, jobOrder.end(), second);
+    return jobOrder;
+}
+
+int unrelatedListSchedule(const ProcessingTimeMatrix& matrix, const vector<int>& jobOrder,
+                          vector<int>& taskAssignments) {
+    int stride = matrix.stride();
+
+    // Padding machines keep an unreachable load; their zero times leave it
+    // unchanged.
+    vector<int> loads(max(stride, kArgminPadding), numeric_limits<int>::max());
+    fill(loads.begin(), loads.begin() + matrix.numMachines(), 0);
+    vector<int> completion(loads.size(), numeric_limits<int>::max());
+    int maxLoad = 0;
+
+    for (size_t i = 0; i < jobOrder.size(); ++i) {
+        const int* row = matrix.row(jobOrder[i]);
+        for (int machine = 0; machine < stride; ++machine) {
+            completion[machine] = loads[machine] + row[machine];
+        }
+
+        bool fitsIn16Bits = static_cast<long long>(maxLoad) + matrix.maxTime() < 65535;
+        int best = argminLoad(completion.data(), static_cast<int>(completion.size()), fitsIn16Bits);
+
+        loads[best] = completion[best];
+        maxLoad = max(maxLoad, loads[best]);
+        taskAssignments[i] = best + 1;
+    }
+    return maxLoad;
+}
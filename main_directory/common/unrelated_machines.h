@@ -0,0 +1,50 @@
+#ifndef UNRELATED_MACHINES_H
+#define UNRELATED_MACHINES_H
+
+#include "task_ordering.h"
+#include <cstddef>
+#include <vector>
+
+// Processing times of unrelated machines (R||Cmax) as one contiguous
+// job-major matrix. Rows are padded with zeros to a multiple of
+// kArgminPadding machines so the scheduling kernel can use full-width vector
+// loads on every row.
+class ProcessingTimeMatrix {
+public:
+    // jobMajorTimes holds numJobs rows of numMachines times; when it is empty
+    // every machine takes durations[j] for job j.
+    ProcessingTimeMatrix(const std::vector<int>& durations, int numMachines, const std::vector<int>& jobMajorTimes);
+
+    int numJobs() const { return jobCount; }
+    int numMachines() const { return machineCount; }
+    int stride() const { return rowStride; }
+    int maxTime() const { return longestTime; }
+
+    const int* row(int job) const { return &times[static_cast<size_t>(job) * rowStride]; }
+    int time(int job, int machine) const { return row(job)[machine]; }
+
+private:
+    int jobCount;
+    int machineCount;
+    int rowStride;
+    int longestTime;
+    std::vector<int> times;
+};
+
+// What an ordering rule sorts unrelated jobs by.
+enum class JobKey { MinTime, MeanTime };
+
+// Job indices in the order of a split rule: the first splitPoint jobs of the
+// input sorted by First, the rest by Second, each by key (stable).
+std::vector<int> orderJobs(const ProcessingTimeMatrix& matrix, JobKey key, int splitPoint, TaskOrder first,
+                           TaskOrder second);
+
+// Assigns jobs in jobOrder one by one to the machine with the smallest
+// completion time load[i] + p[j][i] (lowest index on ties), writes the 1-based
+// machine of each position of jobOrder and returns Cmax. Completion times for
+// all machines are formed with one vector add per row and reduced with the
+// SIMD argmin kernel, so the step stays vectorized at any m.
+int unrelatedListSchedule(const ProcessingTimeMatrix& matrix, const std::vector<int>& jobOrder,
+                          std::vector<int>& taskAssignments);
+
+#endif
@@ -0,0 +1,71 @@
+#include "annealing_script.h"
+#include "../common/instance_io.h"
+#include "../common/list_schedule.h"
+#include "../common/makespan_bounds.h"
+#include "../common/parallel_tempering.h"
+#include "../common/schedule_metrics.h"
+#include "../common/task_ordering.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+using namespace std;
+
+const double kAnnealingTimeBudget = 0.005;
+const int kAnnealingReplicas = 4;
+
+void runAnnealing() {
+    ifstream inputFile("main_directory/input.txt");
+    ofstream outputFile("main_directory/output/annealing_output.txt");
+    ofstream assignmentsFile("main_directory/output/annealing_assignments.txt");
+
+    if (!inputFile || !outputFile || !assignmentsFile) {
+        cerr << "Error opening files for Annealing." << endl;
+        return;
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> jobOrder;
+    vector<int> orderedTasks;
+    vector<int> taskAssignments;
+    ScheduleEvaluator evaluator;
+    while (readInstance(inputFile, instance)) {
+        jobOrder.resize(instance.tasks.size());
+        iota(jobOrder.begin(), jobOrder.end(), 0);
+        orderPositions(instance.tasks, jobOrder.begin(), jobOrder.end(), TaskOrder::Descending);
+        orderedTasks.resize(jobOrder.size());
+        for (size_t i = 0; i < jobOrder.size(); ++i) {
+            orderedTasks[i] = instance.tasks[jobOrder[i]];
+        }
+        taskAssignments.resize(orderedTasks.size());
+
+        auto start = chrono::high_resolution_clock::now();
+
+        listSchedule(orderedTasks, instance.numMachines, taskAssignments);
+        long long lowerBound = makespanLowerBound(orderedTasks, instance.numMachines);
+        AnnealingResult result = parallelTempering(orderedTasks, instance.numMachines, taskAssignments,
+                                                   kAnnealingTimeBudget, kAnnealingReplicas, lowerBound);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        outputFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                   << instance.instanceNumber << " " << result.Cmax << " " << fixed << setprecision(9) << timeTaken
+                   << " " << result.timeToBest << " "
+                   << evaluator.evaluate(instance, jobOrder, taskAssignments) << endl << endl;
+
+        assignmentsFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber
+                        << " " << instance.instanceNumber << endl;
+        for (int assignment : taskAssignments) {
+            assignmentsFile << assignment << " ";
+        }
+        assignmentsFile << endl << endl;
+    }
+
+    inputFile.close();
+    outputFile.close();
+    assignmentsFile.close();
+}
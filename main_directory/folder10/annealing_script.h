@@ -0,0 +1,8 @@
+#ifndef ANNEALING_SCRIPT_H
+#define ANNEALING_SCRIPT_H
+
+// Parallel-tempering annealing seeded from the LPT schedule. The summary line
+// carries the time to the best schedule after the total time.
+void runAnnealing();
+
+#endif
@@ -0,0 +1,82 @@
+#include "genetic_script.h"
+#include "../common/island_genetic.h"
+#include "../common/list_scheduler.h"
+#include "../common/makespan_bounds.h"
+#include "../common/split_sweep.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+const int kGeneticIslands = 4;
+const int kGeneticGenerations = 200;
+const int kMigrationInterval = 20;
+
+// Schedules of every split point the existing kernels use (LPT, SPT, the
+// 50% split and the 5..95% splits), in input task order.
+static vector<vector<int>> kernelSeeds(const Instance& instance) {
+    SplitSweep sweep;
+    sweep.reset(instance.tasks);
+
+    int numJobs = instance.numJobs;
+    vector<int> splits = {0, numJobs, HalfSplit()(numJobs)};
+    for (int sptPercentage = 5; sptPercentage <= 95; sptPercentage += 5) {
+        splits.push_back(PercentageSplit{sptPercentage}(numJobs));
+    }
+
+    vector<vector<int>> seeds;
+    vector<int> positions, orderedTasks(numJobs), taskAssignments(numJobs);
+    for (int split : splits) {
+        sweep.splitPositions(split, positions);
+        for (int i = 0; i < numJobs; ++i) {
+            orderedTasks[i] = instance.tasks[positions[i]];
+        }
+        listSchedule(orderedTasks, instance.numMachines, taskAssignments);
+
+        vector<int> seed(numJobs);
+        for (int i = 0; i < numJobs; ++i) {
+            seed[positions[i]] = taskAssignments[i] - 1;
+        }
+        seeds.push_back(seed);
+    }
+    return seeds;
+}
+
+void runGenetic() {
+    ifstream inputFile("main_directory/input.txt");
+    ofstream outputFile("main_directory/output/genetic_output.txt");
+    ofstream assignmentsFile("main_directory/output/genetic_assignments.txt");
+
+    if (!inputFile || !outputFile || !assignmentsFile) {
+        cerr << "Error opening files for Genetic." << endl;
+        return;
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> taskAssignments;
+    vector<int> jobOrder;
+    vector<int> listAssignments;
+    ScheduleEvaluator evaluator;
+    while (readInstance(inputFile, instance)) {
+        auto start = chrono::high_resolution_clock::now();
+
+        vector<vector<int>> seeds = kernelSeeds(instance);
+        long long lowerBound = makespanLowerBound(instance.tasks, instance.numMachines);
+        islandGenetic(instance.tasks, instance.numMachines, seeds, kGeneticIslands, kGeneticGenerations,
+                      kMigrationInterval, lowerBound, taskAssignments);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        LPTOrder().order(instance.tasks, jobOrder);
+        listOrderAssignments(jobOrder, taskAssignments, listAssignments);
+        RecordOutput{outputFile, assignmentsFile}.write(
+            instance, evaluator.evaluate(instance, jobOrder, listAssignments), timeTaken, listAssignments);
+    }
+
+    inputFile.close();
+    outputFile.close();
+    assignmentsFile.close();
+}
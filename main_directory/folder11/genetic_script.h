@@ -0,0 +1,8 @@
+#ifndef GENETIC_SCRIPT_H
+#define GENETIC_SCRIPT_H
+
+// Island-model GA seeded with the LPT, SPT, mixed and percentage-split
+// schedules. Assignments are written in LPT list order.
+void runGenetic();
+
+#endif
@@ -0,0 +1,57 @@
+#include "ptas_script.h"
+#include "../common/dual_approximation.h"
+#include "../common/instance_io.h"
+#include "../common/list_scheduler.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+const double kPTASEpsilon = 0.2;
+
+void runPTAS() {
+    ifstream inputFile("main_directory/input.txt");
+    ofstream outputFile("main_directory/output/ptas_output.txt");
+    ofstream assignmentsFile("main_directory/output/ptas_assignments.txt");
+
+    if (!inputFile || !outputFile || !assignmentsFile) {
+        cerr << "Error opening files for PTAS." << endl;
+        return;
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> taskAssignments;
+    vector<int> jobOrder;
+    vector<int> listAssignments;
+    ScheduleEvaluator evaluator;
+    while (readInstance(inputFile, instance)) {
+        auto start = chrono::high_resolution_clock::now();
+
+        DualApproximationResult result = dualApproximation(instance.tasks, instance.numMachines, kPTASEpsilon,
+                                                           taskAssignments);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        LPTOrder().order(instance.tasks, jobOrder);
+        listOrderAssignments(jobOrder, taskAssignments, listAssignments);
+        outputFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                   << instance.instanceNumber << " " << result.Cmax << " " << fixed << setprecision(9) << timeTaken
+                   << " " << setprecision(3) << result.epsilon << " "
+                   << evaluator.evaluate(instance, jobOrder, listAssignments) << endl << endl;
+
+        assignmentsFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber
+                        << " " << instance.instanceNumber << endl;
+        for (int assignment : listAssignments) {
+            assignmentsFile << assignment << " ";
+        }
+        assignmentsFile << endl << endl;
+    }
+
+    inputFile.close();
+    outputFile.close();
+    assignmentsFile.close();
+}
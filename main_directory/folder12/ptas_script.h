@@ -0,0 +1,9 @@
+#ifndef PTAS_SCRIPT_H
+#define PTAS_SCRIPT_H
+
+// Hochbaum-Shmoys dual approximation at kPTASEpsilon. The summary line carries
+// the epsilon actually achieved after the time; assignments are in LPT list
+// order.
+void runPTAS();
+
+#endif
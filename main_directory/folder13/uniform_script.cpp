@@ -0,0 +1,87 @@
+#include "uniform_script.h"
+#include "../common/list_scheduler.h"
+#include "../common/uniform_machines.h"
+#include <filesystem>
+using namespace std;
+
+namespace fs = std::filesystem;
+
+template <class OrderPolicy>
+static void runUniformRule(OrderPolicy orderPolicy, const string& name, const string& outputPath,
+                           const string& assignmentsPath) {
+    ifstream inputFile("main_directory/input.txt");
+    ofstream outputFile(outputPath);
+    ofstream assignmentsFile(assignmentsPath);
+
+    if (!inputFile || !outputFile || !assignmentsFile) {
+        cerr << "Error opening files for uniform " << name << "." << endl;
+        return;
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> jobOrder;
+    vector<int> orderedTasks;
+    vector<int> taskAssignments;
+    while (readInstance(inputFile, instance)) {
+        vector<double> speeds = instance.speeds;
+        if (speeds.empty()) {
+            speeds.assign(instance.numMachines, 1.0);
+        }
+        if (!UniformMachines::validSpeeds(speeds)) {
+            cerr << "Skipping instance " << instance.classNumber << " " << instance.instanceNumber
+                 << " for uniform " << name << ": machine speeds must be positive." << endl;
+            continue;
+        }
+
+        orderPolicy.order(instance.tasks, jobOrder);
+        orderedTasks.resize(jobOrder.size());
+        for (size_t i = 0; i < jobOrder.size(); ++i) {
+            orderedTasks[i] = instance.tasks[jobOrder[i]];
+        }
+        taskAssignments.resize(orderedTasks.size());
+
+        auto start = chrono::high_resolution_clock::now();
+
+        double Cmax = UniformMachines(speeds).schedule(orderedTasks, taskAssignments);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        outputFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                   << instance.instanceNumber << " " << fixed << setprecision(3) << Cmax << " " << setprecision(9)
+                   << timeTaken << endl << endl;
+
+        assignmentsFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber
+                        << " " << instance.instanceNumber << endl;
+        for (int assignment : taskAssignments) {
+            assignmentsFile << assignment << " ";
+        }
+        assignmentsFile << endl << endl;
+    }
+
+    inputFile.close();
+    outputFile.close();
+    assignmentsFile.close();
+}
+
+void runUniformMachines() {
+    string outputDirectory = "main_directory/output/uniform_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    runUniformRule(LPTOrder(), "LPT", outputDirectory + "/lpt_output.txt", outputDirectory + "/lpt_assignments.txt");
+    runUniformRule(SPTOrder(), "SPT", outputDirectory + "/spt_output.txt", outputDirectory + "/spt_assignments.txt");
+    runUniformRule(MixedLPTSPTOrder(), "Mixed LPT-SPT", outputDirectory + "/mixed_lpt_spt_output.txt",
+                   outputDirectory + "/mixed_lpt_spt_assignments.txt");
+    runUniformRule(MixedSPTLPTOrder(), "Mixed SPT-LPT", outputDirectory + "/mixed_spt_lpt_output.txt",
+                   outputDirectory + "/mixed_spt_lpt_assignments.txt");
+
+    for (int sptPercentage = 5; sptPercentage <= 95; sptPercentage += 5) {
+        typedef SplitOrder<TaskOrder::Ascending, TaskOrder::Descending, PercentageSplit> PercentageOrder;
+        string prefix = outputDirectory + "/percentage_" + to_string(sptPercentage);
+        runUniformRule(PercentageOrder{PercentageSplit{sptPercentage}}, "percentage " + to_string(sptPercentage),
+                       prefix + "_output.txt", prefix + "_assignments.txt");
+    }
+}
@@ -0,0 +1,9 @@
+#ifndef UNIFORM_SCRIPT_H
+#define UNIFORM_SCRIPT_H
+
+// Runs LPT, SPT, both mixed rules and every percentage split on uniform
+// machines, using the speeds given in input.txt (all 1 when absent). Results
+// go to output/uniform_output, with Cmax = max(load / speed).
+void runUniformMachines();
+
+#endif
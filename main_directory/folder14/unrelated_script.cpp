@@ -0,0 +1,90 @@
+#include "unrelated_script.h"
+#include "../common/instance_io.h"
+#include "../common/list_scheduler.h"
+#include "../common/unrelated_machines.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+namespace fs = std::filesystem;
+
+struct UnrelatedRule {
+    string name;
+    function<int(int)> splitRule;
+    TaskOrder first;
+    TaskOrder second;
+};
+
+void runUnrelatedMachines() {
+    ifstream inputFile("main_directory/unrelated_input.txt");
+    if (!inputFile) {
+        cerr << "Error opening input file for unrelated machines." << endl;
+        return;
+    }
+
+    string outputDirectory = "main_directory/output/unrelated_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    auto none = [](int) { return 0; };
+    vector<UnrelatedRule> rules = {
+        {"lpt", none, TaskOrder::Descending, TaskOrder::Descending},
+        {"spt", none, TaskOrder::Ascending, TaskOrder::Ascending},
+        {"mixed_lpt_spt", HalfSplit(), TaskOrder::Descending, TaskOrder::Ascending},
+        {"mixed_spt_lpt", HalfSplit(), TaskOrder::Ascending, TaskOrder::Descending},
+    };
+    for (int sptPercentage = 5; sptPercentage <= 95; sptPercentage += 5) {
+        rules.push_back({"percentage_" + to_string(sptPercentage), PercentageSplit{sptPercentage},
+                         TaskOrder::Ascending, TaskOrder::Descending});
+    }
+
+    vector<pair<JobKey, string>> keys = {{JobKey::MinTime, "min"}, {JobKey::MeanTime, "mean"}};
+
+    vector<ofstream> summaryFiles(rules.size() * keys.size());
+    vector<ofstream> assignmentsFiles(rules.size() * keys.size());
+    for (size_t r = 0; r < rules.size(); ++r) {
+        for (size_t k = 0; k < keys.size(); ++k) {
+            string prefix = outputDirectory + "/" + rules[r].name + "_" + keys[k].second;
+            summaryFiles[r * keys.size() + k].open(prefix + "_output.txt");
+            assignmentsFiles[r * keys.size() + k].open(prefix + "_assignments.txt");
+        }
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> taskAssignments;
+    while (readInstance(inputFile, instance)) {
+        ProcessingTimeMatrix matrix(instance.tasks, instance.numMachines, instance.processingTimes);
+        taskAssignments.resize(instance.tasks.size());
+
+        for (size_t r = 0; r < rules.size(); ++r) {
+            for (size_t k = 0; k < keys.size(); ++k) {
+                int splitPoint = rules[r].splitRule(instance.numJobs);
+                vector<int> jobOrder = orderJobs(matrix, keys[k].first, splitPoint, rules[r].first, rules[r].second);
+
+                auto start = chrono::high_resolution_clock::now();
+
+                int Cmax = unrelatedListSchedule(matrix, jobOrder, taskAssignments);
+
+                auto end = chrono::high_resolution_clock::now();
+                double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+                RecordOutput{summaryFiles[r * keys.size() + k], assignmentsFiles[r * keys.size() + k]}.write(
+                    instance, Cmax, timeTaken, taskAssignments);
+            }
+        }
+    }
+
+    inputFile.close();
+    for (size_t f = 0; f < summaryFiles.size(); ++f) {
+        summaryFiles[f].close();
+        assignmentsFiles[f].close();
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef UNRELATED_SCRIPT_H
+#define UNRELATED_SCRIPT_H
+
+// Runs LPT, SPT, both mixed rules and every percentage split on the unrelated
+// machines of unrelated_input.txt, once with jobs keyed by their shortest
+// processing time and once by their mean. Results go to
+// output/unrelated_output as <rule>_<key>_output.txt and _assignments.txt.
+void runUnrelatedMachines();
+
+#endif
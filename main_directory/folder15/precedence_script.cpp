@@ -0,0 +1,69 @@
+#include "precedence_script.h"
+#include "../common/list_scheduler.h"
+#include "../common/precedence_scheduler.h"
+#include <filesystem>
+using namespace std;
+
+namespace fs = std::filesystem;
+
+void runPrecedence() {
+    ifstream inputFile("main_directory/precedence_input.txt");
+    if (!inputFile) {
+        cerr << "Error opening input file for Precedence." << endl;
+        return;
+    }
+
+    string outputDirectory = "main_directory/output/precedence_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    vector<pair<ReadyPriority, string>> priorities = {
+        {ReadyPriority::Longest, "lpt"}, {ReadyPriority::Shortest, "spt"}, {ReadyPriority::CriticalPath, "critical_path"}
+    };
+
+    vector<ofstream> summaryFiles(priorities.size());
+    vector<ofstream> assignmentsFiles(priorities.size());
+    for (size_t p = 0; p < priorities.size(); ++p) {
+        summaryFiles[p].open(outputDirectory + "/" + priorities[p].second + "_output.txt");
+        assignmentsFiles[p].open(outputDirectory + "/" + priorities[p].second + "_assignments.txt");
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> taskAssignments;
+    vector<long long> completionTimes;
+    vector<int> jobOrder;
+    vector<int> listAssignments;
+    ScheduleEvaluator evaluator;
+    while (readInstance(inputFile, instance)) {
+        PrecedenceGraph graph = buildPrecedenceGraph(instance.numJobs, instance.precedences);
+        LPTOrder().order(instance.tasks, jobOrder);
+
+        for (size_t p = 0; p < priorities.size(); ++p) {
+            auto start = chrono::high_resolution_clock::now();
+
+            long long Cmax = precedenceListSchedule(instance.tasks, instance.numMachines, graph, priorities[p].first,
+                                                    taskAssignments, completionTimes);
+
+            auto end = chrono::high_resolution_clock::now();
+            double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+            // A cycle defeats every priority, so the instance gets no rows.
+            if (Cmax < 0) {
+                cerr << "Precedence cycle in instance " << instance.numJobs << " " << instance.numMachines << " "
+                     << instance.classNumber << " " << instance.instanceNumber << ", skipped." << endl;
+                break;
+            }
+            listOrderAssignments(jobOrder, taskAssignments, listAssignments);
+            RecordOutput{summaryFiles[p], assignmentsFiles[p]}.write(
+                instance, evaluator.evaluate(instance, taskAssignments, completionTimes), timeTaken, listAssignments);
+        }
+    }
+
+    inputFile.close();
+    for (size_t p = 0; p < priorities.size(); ++p) {
+        summaryFiles[p].close();
+        assignmentsFiles[p].close();
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef PRECEDENCE_SCRIPT_H
+#define PRECEDENCE_SCRIPT_H
+
+// DAG-aware list scheduling with LPT, SPT and critical-path priorities. Uses
+// the "edges" block of each instance in precedence_input.txt (none means
+// independent jobs) and writes to output/precedence_output; assignments are in
+// LPT list order and the completion sums include any idle time. Instances
+// whose edges form a cycle are reported on stderr and get no rows.
+void runPrecedence();
+
+#endif
@@ -0,0 +1,81 @@
+#include "eligibility_script.h"
+#include "../common/eligibility_scheduler.h"
+#include "../common/list_scheduler.h"
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+using namespace std;
+
+namespace fs = std::filesystem;
+
+void runEligibility() {
+    string outputDirectory = "main_directory/output/eligibility_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    for (const string pattern : {"nested", "interval", "random"}) {
+        ifstream inputFile("main_directory/eligibility_" + pattern + "_input.txt");
+        ofstream outputFile(outputDirectory + "/" + pattern + "_lpt_output.txt");
+        ofstream assignmentsFile(outputDirectory + "/" + pattern + "_lpt_assignments.txt");
+
+        if (!inputFile || !outputFile || !assignmentsFile) {
+            cerr << "Error opening files for eligibility pattern " << pattern << "." << endl;
+            continue;
+        }
+
+        double eligibleTime = 0;
+        double unconstrainedTime = 0;
+
+        skipInputHeader(inputFile);
+        Instance instance;
+        vector<int> taskAssignments;
+        vector<int> orderedTasks;
+        vector<int> listAssignments;
+        ScheduleEvaluator evaluator;
+        while (readInstance(inputFile, instance)) {
+            EligibilitySets sets(instance.numJobs, instance.numMachines, instance.eligibleOffsets,
+                                 instance.eligibleMachines);
+
+            vector<int> jobOrder(instance.tasks.size());
+            iota(jobOrder.begin(), jobOrder.end(), 0);
+            stable_sort(jobOrder.begin(), jobOrder.end(),
+                        [&](int a, int b) { return instance.tasks[a] > instance.tasks[b]; });
+
+            auto start = chrono::high_resolution_clock::now();
+
+            int Cmax = eligibleListSchedule(instance.tasks, jobOrder, sets, taskAssignments);
+
+            auto end = chrono::high_resolution_clock::now();
+            double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+            eligibleTime += timeTaken;
+
+            listOrderAssignments(jobOrder, taskAssignments, listAssignments);
+            if (Cmax < 0) {
+                cerr << "Job without an eligible machine in instance " << instance.numJobs << " "
+                     << instance.numMachines << " " << instance.classNumber << " " << instance.instanceNumber << "."
+                     << endl;
+                RecordOutput{outputFile, assignmentsFile}.write(instance, Cmax, timeTaken, listAssignments);
+            } else {
+                RecordOutput{outputFile, assignmentsFile}.write(
+                    instance, evaluator.evaluate(instance, jobOrder, listAssignments), timeTaken, listAssignments);
+            }
+
+            orderedTasks.resize(instance.tasks.size());
+            for (size_t j = 0; j < jobOrder.size(); ++j) {
+                orderedTasks[j] = instance.tasks[jobOrder[j]];
+            }
+            start = chrono::high_resolution_clock::now();
+            listSchedule(orderedTasks, instance.numMachines, taskAssignments);
+            end = chrono::high_resolution_clock::now();
+            unconstrainedTime += chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+        }
+
+        cout << "Eligibility " << pattern << ": LPT " << fixed << setprecision(9) << eligibleTime
+             << " s, unconstrained LPT " << unconstrainedTime << " s" << endl;
+
+        inputFile.close();
+        outputFile.close();
+        assignmentsFile.close();
+    }
+}
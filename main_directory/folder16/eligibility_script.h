@@ -0,0 +1,11 @@
+#ifndef ELIGIBILITY_SCRIPT_H
+#define ELIGIBILITY_SCRIPT_H
+
+// Runs LPT with machine eligibility on eligibility_<pattern>_input.txt for the
+// nested, interval and random patterns, writing output/eligibility_output/
+// <pattern>_lpt_output.txt and _assignments.txt (LPT list order). The same
+// instances are also scheduled by unconstrained LPT and both total times are
+// printed, so the cost of the masked selection can be compared.
+void runEligibility();
+
+#endif
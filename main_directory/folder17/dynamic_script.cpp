@@ -0,0 +1,110 @@
+#include "dynamic_script.h"
+#include "../common/dynamic_schedule.h"
+#include "../common/instance_io.h"
+#include "../common/list_schedule.h"
+#include "../common/task_ordering.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+using namespace std;
+
+const int kDynamicUpdates = 1000;
+const int kRepairMoves = 8;
+
+// One update of the stream: an insertion of the given duration, or the
+// cancellation of live job number value % (live jobs).
+struct ScheduleUpdate {
+    bool insert;
+    int value;
+};
+
+static vector<ScheduleUpdate> updateStream(const Instance& instance) {
+    mt19937 gen(instance.numJobs * 100000 + instance.numMachines * 1000 + instance.classNumber * 100 +
+                instance.instanceNumber);
+    uniform_int_distribution<> duration(*min_element(instance.tasks.begin(), instance.tasks.end()),
+                                        *max_element(instance.tasks.begin(), instance.tasks.end()));
+    bernoulli_distribution insert(0.5);
+
+    vector<ScheduleUpdate> updates(kDynamicUpdates);
+    for (ScheduleUpdate& update : updates) {
+        update.insert = insert(gen);
+        update.value = update.insert ? duration(gen) : static_cast<int>(gen() >> 1);
+    }
+    return updates;
+}
+
+void runDynamicSchedule() {
+    ifstream inputFile("main_directory/input.txt");
+    ofstream outputFile("main_directory/output/dynamic_output.txt");
+
+    if (!inputFile || !outputFile) {
+        cerr << "Error opening files for Dynamic schedule." << endl;
+        return;
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> orderedTasks;
+    vector<int> taskAssignments;
+    while (readInstance(inputFile, instance)) {
+        if (instance.tasks.empty()) {
+            continue;
+        }
+        vector<ScheduleUpdate> updates = updateStream(instance);
+
+        orderedTasks = instance.tasks;
+        orderTasks(orderedTasks.begin(), orderedTasks.end(), TaskOrder::Descending);
+        DynamicSchedule schedule(instance.numMachines);
+        vector<int> liveJobs;
+        for (int duration : orderedTasks) {
+            liveJobs.push_back(schedule.insertJob(duration));
+        }
+
+        auto start = chrono::high_resolution_clock::now();
+        for (const ScheduleUpdate& update : updates) {
+            if (update.insert || liveJobs.empty()) {
+                liveJobs.push_back(schedule.insertJob(update.insert ? update.value : 1));
+            } else {
+                size_t k = update.value % liveJobs.size();
+                schedule.removeJob(liveJobs[k]);
+                liveJobs[k] = liveJobs.back();
+                liveJobs.pop_back();
+            }
+            schedule.rebalance(kRepairMoves);
+        }
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        // The baseline keeps the live durations in the same order and
+        // rebuilds the LPT schedule from scratch after every update.
+        vector<int> liveDurations = orderedTasks;
+        int rescheduleCmax = 0;
+        start = chrono::high_resolution_clock::now();
+        for (const ScheduleUpdate& update : updates) {
+            if (update.insert || liveDurations.empty()) {
+                liveDurations.push_back(update.insert ? update.value : 1);
+            } else {
+                size_t k = update.value % liveDurations.size();
+                liveDurations[k] = liveDurations.back();
+                liveDurations.pop_back();
+            }
+            orderedTasks = liveDurations;
+            orderTasks(orderedTasks.begin(), orderedTasks.end(), TaskOrder::Descending);
+            taskAssignments.resize(orderedTasks.size());
+            rescheduleCmax = listSchedule(orderedTasks, instance.numMachines, taskAssignments);
+        }
+        end = chrono::high_resolution_clock::now();
+        double rescheduleTime = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        outputFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                   << instance.instanceNumber << " " << schedule.Cmax() << " " << fixed << setprecision(9)
+                   << timeTaken << " " << rescheduleCmax << " " << rescheduleTime << endl << endl;
+    }
+
+    inputFile.close();
+    outputFile.close();
+}
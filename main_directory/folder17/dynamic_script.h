@@ -0,0 +1,12 @@
+#ifndef DYNAMIC_SCRIPT_H
+#define DYNAMIC_SCRIPT_H
+
+// Starts from the LPT schedule of every instance in input.txt and replays a
+// seeded stream of job insertions and cancellations, once on a
+// DynamicSchedule with a bounded repair after each update and once by
+// re-running LPT over the live jobs after each update. Writes
+// "n m class instance Cmax time rescheduleCmax rescheduleTime" (final Cmax,
+// total update time) to output/dynamic_output.txt.
+void runDynamicSchedule();
+
+#endif
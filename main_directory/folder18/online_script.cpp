@@ -0,0 +1,82 @@
+#include "online_script.h"
+#include "../common/list_scheduler.h"
+#include <filesystem>
+using namespace std;
+
+namespace fs = std::filesystem;
+
+void runOnlineSchedule() {
+    ifstream inputFile("main_directory/input.txt");
+    if (!inputFile) {
+        cerr << "Error opening input file for Online." << endl;
+        return;
+    }
+
+    string outputDirectory = "main_directory/output/online_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    vector<pair<OnlineRule, string>> rules = {{OnlineRule::Graham, "graham"}, {OnlineRule::Albers, "albers"}};
+    vector<ofstream> summaryFiles(rules.size());
+    vector<ofstream> assignmentsFiles(rules.size());
+    for (size_t r = 0; r < rules.size(); ++r) {
+        summaryFiles[r].open(outputDirectory + "/" + rules[r].second + "_output.txt");
+        assignmentsFiles[r].open(outputDirectory + "/" + rules[r].second + "_assignments.txt");
+    }
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    vector<int> taskAssignments;
+    ScheduleEvaluator evaluator;
+    while (readInstance(inputFile, instance)) {
+        taskAssignments.resize(instance.tasks.size());
+
+        for (size_t r = 0; r < rules.size(); ++r) {
+            auto start = chrono::high_resolution_clock::now();
+
+            OnlineScheduler scheduler(instance.numMachines, rules[r].first);
+            for (size_t j = 0; j < instance.tasks.size(); ++j) {
+                taskAssignments[j] = scheduler.assign(instance.tasks[j]) + 1;
+            }
+
+            auto end = chrono::high_resolution_clock::now();
+            double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+            RecordOutput{summaryFiles[r], assignmentsFiles[r]}.write(
+                instance, evaluator.evaluate(instance, taskAssignments), timeTaken, taskAssignments);
+        }
+    }
+
+    inputFile.close();
+    for (size_t r = 0; r < rules.size(); ++r) {
+        summaryFiles[r].close();
+        assignmentsFiles[r].close();
+    }
+}
+
+void runStreaming(istream& input, int numMachines, OnlineRule rule, long long reportInterval) {
+    OnlineScheduler scheduler(numMachines, rule);
+    JobStreamReader reader(input);
+
+    auto start = chrono::high_resolution_clock::now();
+    auto report = [&]() {
+        auto now = chrono::high_resolution_clock::now();
+        double elapsed = chrono::duration_cast<chrono::nanoseconds>(now - start).count() / 1e9;
+        cout << scheduler.jobsScheduled() << " " << scheduler.Cmax() << " " << fixed << setprecision(9) << elapsed
+             << endl;
+    };
+
+    int duration;
+    long long untilReport = reportInterval;
+    while (reader.next(duration)) {
+        scheduler.assign(duration);
+        if (--untilReport == 0) {
+            report();
+            untilReport = reportInterval;
+        }
+    }
+    if (untilReport != reportInterval || scheduler.jobsScheduled() == 0) {
+        report();
+    }
+}
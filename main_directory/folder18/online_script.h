@@ -0,0 +1,17 @@
+#ifndef ONLINE_SCRIPT_H
+#define ONLINE_SCRIPT_H
+
+#include "../common/online_scheduler.h"
+#include <istream>
+
+// Schedules each instance of input.txt online, jobs arriving in input order,
+// with the Graham and Albers rules. Writes output/online_output/
+// <rule>_output.txt and _assignments.txt.
+void runOnlineSchedule();
+
+// Streaming mode: assigns every duration read from input as it arrives and
+// prints "jobs Cmax seconds" after every reportInterval jobs and once at the
+// end. Memory stays O(m) however long the stream is.
+void runStreaming(std::istream& input, int numMachines, OnlineRule rule, long long reportInterval);
+
+#endif
@@ -0,0 +1,121 @@
+#include "breakpoint_script.h"
+#include "../common/breakpoint_search.h"
+#include "../common/list_scheduler.h"
+#include "../common/split_sweep.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+using namespace std;
+
+namespace fs = std::filesystem;
+
+const int kBreakpointGridPercent = 5;
+// Within one sweep's time the search rarely gets through the 2-breakpoint
+// family, so 3 breakpoints would never be reached.
+const int kBreakpointCount = 2;
+
+// Runs the 5..95% SPT -> LPT sweep the way runPercentageSPT_LPT() does and
+// returns its best split as a one-breakpoint sequence.
+BreakpointResult bestPercentageSplit(const Instance& instance, SplitSweep& sweep, vector<int>& orderedTasks,
+                                     vector<int>& taskAssignments) {
+    sweep.reset(instance.tasks);
+    taskAssignments.resize(instance.tasks.size());
+
+    BreakpointResult best = {numeric_limits<long long>::max(), {}, {}, 0, {}, true};
+    int previousSptCount = -1;
+    for (int sptPercentage = kBreakpointGridPercent; sptPercentage < 100; sptPercentage += kBreakpointGridPercent) {
+        int sptCount = PercentageSplit{sptPercentage}(instance.numJobs);
+        if (sptCount == previousSptCount) {
+            continue;
+        }
+        previousSptCount = sptCount;
+
+        sweep.orderSplit(sptCount, orderedTasks);
+        int Cmax = listSchedule(orderedTasks, instance.numMachines, taskAssignments);
+        if (Cmax < best.Cmax) {
+            best.Cmax = Cmax;
+            best.breakpoints.clear();
+            best.segmentOrders.clear();
+            if (sptCount > 0 && sptCount < instance.numJobs) {
+                best.breakpoints.push_back(sptCount);
+            }
+            if (sptCount > 0) {
+                best.segmentOrders.push_back(TaskOrder::Ascending);
+            }
+            if (sptCount < instance.numJobs) {
+                best.segmentOrders.push_back(TaskOrder::Descending);
+            }
+        }
+    }
+    return best;
+}
+
+void runBreakpointSearch() {
+    ifstream inputFile("main_directory/input.txt");
+    if (!inputFile) {
+        cerr << "Error opening input file for breakpoint search." << endl;
+        return;
+    }
+
+    string outputDirectory = "main_directory/output/breakpoint_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    ofstream outputFile(outputDirectory + "/k" + to_string(kBreakpointCount) + "_output.txt");
+    if (!outputFile) {
+        cerr << "Error opening output file for breakpoint search." << endl;
+        return;
+    }
+
+    long long cumulativeCmax = 0;
+    double totalTime = 0;
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    SplitSweep sweep;
+    vector<int> orderedTasks;
+    vector<int> taskAssignments;
+    while (readInstance(inputFile, instance)) {
+        auto start = chrono::high_resolution_clock::now();
+
+        // The sweep's best split is the incumbent, and the search may spend
+        // as long again as the sweep itself took.
+        BreakpointResult incumbent = bestPercentageSplit(instance, sweep, orderedTasks, taskAssignments);
+        auto swept = chrono::high_resolution_clock::now();
+        double sweepTime = chrono::duration_cast<chrono::nanoseconds>(swept - start).count() / 1e9;
+        BreakpointResult result = searchBreakpoints(instance.tasks, instance.numMachines, kBreakpointCount,
+                                                    kBreakpointGridPercent, incumbent, sweepTime);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+        cumulativeCmax += result.Cmax;
+        totalTime += timeTaken;
+
+        outputFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                   << instance.instanceNumber << " " << result.Cmax << " " << fixed << setprecision(9) << timeTaken
+                   << " " << result.segmentsScheduled << " " << result.complete;
+        for (long long sequences : result.sequencesTried) {
+            outputFile << " " << sequences;
+        }
+        for (int breakpoint : result.breakpoints) {
+            outputFile << " " << breakpoint;
+        }
+        outputFile << " ";
+        for (TaskOrder order : result.segmentOrders) {
+            outputFile << (order == TaskOrder::Ascending ? 'A' : 'D');
+        }
+        outputFile << endl << endl;
+    }
+
+    cout << kBreakpointCount << "-breakpoint search: cumulative Cmax " << cumulativeCmax << " in " << fixed
+         << setprecision(6) << totalTime << " s" << endl;
+
+    inputFile.close();
+    outputFile.close();
+}
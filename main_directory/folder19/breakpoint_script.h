@@ -0,0 +1,13 @@
+#ifndef BREAKPOINT_SCRIPT_H
+#define BREAKPOINT_SCRIPT_H
+
+// Searches the up-to-2-breakpoint segment orderings of every instance in
+// input.txt on the 5% percentage grid. Each search starts from the best
+// split of the 5..95% SPT-LPT sweep and gets as much time again as that
+// sweep took. Writes output/breakpoint_output/k2_output.txt as "n m class
+// instance Cmax time segments complete s0 s1 s2 b1 ... orders": s<k> counts
+// the k-breakpoint sequences tried, orders has one A (ascending) or D
+// (descending) per segment, and complete is 0 when time ran out.
+void runBreakpointSearch();
+
+#endif
@@ -1,7 +1,9 @@
 #include "percentage_spt_lpt_script.h"
+#include "../common/list_scheduler.h"
+#include "../common/split_point_search.h"
+#include "../common/split_sweep.h"
 #include <algorithm>
 #include <chrono>
-#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -14,55 +16,6 @@ using namespace std;
 
 namespace fs = std::filesystem;
 
-int schedulePercentageSPT_LPT(const vector<int> &tasks, int numMachines,
-                               int sptPercentage, ofstream &summaryFile,
-                               ofstream &assignmentsFile, int classNumber,
-                               int instanceNumber) {
-    vector<int> machineTimes(numMachines, 0);
-    vector<int> taskAssignments(tasks.size());
-
-    int sptCount = static_cast<int>(round((sptPercentage / 100.0) * tasks.size()));
-    vector<int> firstPart(tasks.begin(), tasks.begin() + sptCount);
-    vector<int> secondPart(tasks.begin() + sptCount, tasks.end());
-
-    sort(firstPart.begin(), firstPart.end());        
-    sort(secondPart.rbegin(), secondPart.rend());    
-
-    auto start = chrono::high_resolution_clock::now();
-
-    int taskIndex = 0;
-
-    for (int task : firstPart) {
-        int minMachine = min_element(machineTimes.begin(), machineTimes.end()) - machineTimes.begin();
-        machineTimes[minMachine] += task;
-        taskAssignments[taskIndex++] = minMachine + 1; 
-    }
-
-    for (int task : secondPart) {
-        int minMachine = min_element(machineTimes.begin(), machineTimes.end()) - machineTimes.begin();
-        machineTimes[minMachine] += task;
-        taskAssignments[taskIndex++] = minMachine + 1; 
-    }
-
-    auto end = chrono::high_resolution_clock::now();
-
-    int Cmax = *max_element(machineTimes.begin(), machineTimes.end());
-    double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
-
-    summaryFile << tasks.size() << " " << numMachines << " " << classNumber << " "
-                << instanceNumber << " " << Cmax << " " << fixed
-                << setprecision(9) << timeTaken << endl << endl;
-
-    assignmentsFile << tasks.size() << " " << numMachines << " " << classNumber
-                    << " " << instanceNumber << endl;
-    for (int assignment : taskAssignments) {
-        assignmentsFile << assignment << " ";
-    }
-    assignmentsFile << endl << endl; 
-
-    return Cmax; 
-}
-
 void runPercentageSPT_LPT() {
     ifstream inputFile("main_directory/input.txt");
     if (!inputFile) {
@@ -75,52 +28,84 @@ void runPercentageSPT_LPT() {
         fs::create_directories(outputDirectory);
     }
 
-    string firstLine;
-    getline(inputFile, firstLine);
-
-    int numJobs, numMachines, classNumber, instanceNumber;
-
     map<pair<int, int>, vector<int>> results;
     vector<int> percentages;
 
     for (int sptPercentage = 5; sptPercentage <= 95; sptPercentage += 5) {
         percentages.push_back(sptPercentage);
+    }
 
-        string percentageFolder = outputDirectory + "/percentage_" + to_string(sptPercentage);
+    vector<ofstream> summaryFiles(percentages.size());
+    vector<ofstream> assignmentsFiles(percentages.size());
+    vector<bool> opened(percentages.size(), false);
+
+    for (size_t p = 0; p < percentages.size(); ++p) {
+        string percentageFolder = outputDirectory + "/percentage_" + to_string(percentages[p]);
         if (!fs::exists(percentageFolder)) {
             fs::create_directories(percentageFolder);
         }
 
-        string summaryFilePath = percentageFolder + "/summary_output.txt";
-        string assignmentsFilePath = percentageFolder + "/assignments_output.txt";
-
-        ofstream summaryFile(summaryFilePath, ios::trunc);
-        ofstream assignmentsFile(assignmentsFilePath, ios::trunc);
+        summaryFiles[p].open(percentageFolder + "/summary_output.txt", ios::trunc);
+        assignmentsFiles[p].open(percentageFolder + "/assignments_output.txt", ios::trunc);
 
-        if (!summaryFile || !assignmentsFile) {
-            cerr << "Error opening output files for percentage " << sptPercentage << "." << endl;
+        if (!summaryFiles[p] || !assignmentsFiles[p]) {
+            cerr << "Error opening output files for percentage " << percentages[p] << "." << endl;
             continue;
         }
+        opened[p] = true;
+    }
+
+    // Every instance is read and sorted once; each percentage derives its
+    // split ordering from that sort, and percentages that round to the same
+    // SPT count reuse the schedule of the previous one.
+    skipInputHeader(inputFile);
+
+    Instance instance;
+    SplitSweep sweep;
+    vector<int> orderedTasks;
+    vector<int> jobOrder;
+    vector<int> taskAssignments;
+    ScheduleEvaluator evaluator;
+    ScheduleMetrics metrics = {};
+
+    while (readInstance(inputFile, instance)) {
+        sweep.reset(instance.tasks);
+        taskAssignments.resize(instance.tasks.size());
+
+        int previousSptCount = -1;
+        int Cmax = 0;
+        double timeTaken = 0;
+
+        for (size_t p = 0; p < percentages.size(); ++p) {
+            if (!opened[p]) {
+                continue;
+            }
+
+            int sptCount = PercentageSplit{percentages[p]}(instance.numJobs);
+            if (sptCount != previousSptCount) {
+                sweep.orderSplit(sptCount, orderedTasks);
 
-        inputFile.clear();
-        inputFile.seekg(0, ios::beg);
-        getline(inputFile, firstLine); 
+                auto start = chrono::high_resolution_clock::now();
 
-        while (inputFile >> numJobs >> numMachines >> classNumber >> instanceNumber) {
-            vector<int> tasks(numJobs);
-            for (int i = 0; i < numJobs; ++i) {
-                inputFile >> tasks[i];
+                Cmax = listSchedule(orderedTasks, instance.numMachines, taskAssignments);
+
+                auto end = chrono::high_resolution_clock::now();
+
+                timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+                sweep.splitPositions(sptCount, jobOrder);
+                metrics = evaluator.evaluate(instance, jobOrder, taskAssignments);
+                previousSptCount = sptCount;
             }
 
-            int Cmax = schedulePercentageSPT_LPT(tasks, numMachines, sptPercentage,
-                                                 summaryFile, assignmentsFile,
-                                                 classNumber, instanceNumber);
+            RecordOutput{summaryFiles[p], assignmentsFiles[p]}.write(instance, metrics, timeTaken, taskAssignments);
 
-            results[make_pair(numJobs * 100 + numMachines, classNumber * 10 + instanceNumber)].push_back(Cmax);
+            results[make_pair(instance.numJobs * 100 + instance.numMachines, instance.classNumber * 10 + instance.instanceNumber)].push_back(Cmax);
         }
+    }
 
-        summaryFile.close();
-        assignmentsFile.close();
+    for (size_t p = 0; p < percentages.size(); ++p) {
+        summaryFiles[p].close();
+        assignmentsFiles[p].close();
     }
 
     inputFile.close();
@@ -186,3 +171,45 @@ void runPercentageSPT_LPT() {
     csvFile.close();
     cout << "Results written to " << csvFilePath << endl;
 }
+
+void runExhaustiveSplitSPT_LPT() {
+    ifstream inputFile("main_directory/input.txt");
+    if (!inputFile) {
+        cerr << "Error opening input file for exhaustive SPT-LPT split." << endl;
+        return;
+    }
+
+    string outputDirectory = "main_directory/output/percentage_output";
+    if (!fs::exists(outputDirectory)) {
+        fs::create_directories(outputDirectory);
+    }
+
+    string summaryFilePath = outputDirectory + "/exhaustive_split_output.txt";
+    ofstream summaryFile(summaryFilePath);
+    if (!summaryFile) {
+        cerr << "Error opening output file for exhaustive SPT-LPT split." << endl;
+        return;
+    }
+
+    skipInputHeader(inputFile);
+
+    Instance instance;
+    long long cumulativeCmax = 0;
+    while (readInstance(inputFile, instance)) {
+        auto start = chrono::high_resolution_clock::now();
+
+        SplitPointResult best = findBestSplitPoint(instance.tasks, instance.numMachines);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        summaryFile << instance.numJobs << " " << instance.numMachines << " " << instance.classNumber << " "
+                    << instance.instanceNumber << " " << best.bestSplit << " " << best.Cmax << " " << fixed
+                    << setprecision(9) << timeTaken << endl << endl;
+        cumulativeCmax += best.Cmax;
+    }
+
+    inputFile.close();
+    summaryFile.close();
+    cout << "Results written to " << summaryFilePath << " (cumulative Cmax " << cumulativeCmax << ")" << endl;
+}
@@ -3,4 +3,8 @@
 
 void runPercentageSPT_LPT();
 
+// Tries every SPT -> LPT split point of every instance and writes the best
+// split and its Cmax to percentage_output/exhaustive_split_output.txt.
+void runExhaustiveSplitSPT_LPT();
+
 #endif // PERCENTAGE_SPT_LPT_SCRIPT_H
@@ -0,0 +1,375 @@
+#include "exact_script.h"
+#include "../common/instance_io.h"
+#include "../common/list_schedule.h"
+#include "../common/list_scheduler.h"
+#include "../common/makespan_bounds.h"
+#include "../common/schedule_metrics.h"
+#include "../common/split_sweep.h"
+#include "../common/two_machine_partition.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+using namespace std;
+
+// Instances that a single thread closes within this many nodes never start
+// the worker pool.
+const long long kSequentialNodeBudget = 200000;
+const long long kExactNodeLimit = 50000000;
+
+// Subtrees with fewer unplaced jobs than this are always searched locally.
+const int kMinSharedJobs = 4;
+
+struct SearchNode {
+    int depth;
+    vector<int> loads;
+    vector<int> machineOf;
+};
+
+struct WorkerQueue {
+    mutex lock;
+    deque<SearchNode> nodes;
+};
+
+class ParallelSearch {
+public:
+    ParallelSearch(const vector<int>& durations, int numMachines, long long lowerBound, int incumbentCmax,
+                   long long nodeLimit, int numThreads)
+        : durations(durations), numMachines(numMachines), lowerBound(lowerBound), nodeLimit(nodeLimit),
+          numThreads(numThreads), queues(numThreads), remainingWork(durations.size() + 1, 0),
+          bestCmax(incumbentCmax + 1), bestMachineOf(durations.size(), 0), nodes(0), outstanding(0),
+          idleWorkers(0), stop(false), limitReached(false), solutionFound(false) {
+        for (int j = static_cast<int>(durations.size()) - 1; j >= 0; --j) {
+            remainingWork[j] = remainingWork[j + 1] + durations[j];
+        }
+    }
+
+    void run() {
+        SearchNode root = {0, vector<int>(numMachines, 0), vector<int>(durations.size(), 0)};
+        queues[0].nodes.push_back(root);
+        outstanding = 1;
+
+        if (numThreads == 1) {
+            worker(0);
+            return;
+        }
+
+        vector<thread> threads;
+        for (int id = 0; id < numThreads; ++id) {
+            threads.emplace_back(&ParallelSearch::worker, this, id);
+        }
+        for (thread& t : threads) {
+            t.join();
+        }
+    }
+
+    int Cmax() const { return bestCmax.load(); }
+    bool proven() const { return !limitReached.load(); }
+    bool found() const { return solutionFound; }
+    long long nodeCount() const { return nodes.load(); }
+    const vector<int>& machineOf() const { return bestMachineOf; }
+
+private:
+    bool takeNode(int id, SearchNode& node) {
+        {
+            lock_guard<mutex> guard(queues[id].lock);
+            if (!queues[id].nodes.empty()) {
+                node = move(queues[id].nodes.back());
+                queues[id].nodes.pop_back();
+                return true;
+            }
+        }
+        for (int offset = 1; offset < numThreads; ++offset) {
+            WorkerQueue& victim = queues[(id + offset) % numThreads];
+            lock_guard<mutex> guard(victim.lock);
+            if (!victim.nodes.empty()) {
+                node = move(victim.nodes.front());
+                victim.nodes.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker(int id) {
+        SearchNode node;
+        while (!stop.load(memory_order_relaxed) && outstanding.load() > 0) {
+            if (!takeNode(id, node)) {
+                idleWorkers++;
+                while (!stop.load(memory_order_relaxed) && outstanding.load() > 0 && !hasWork()) {
+                    this_thread::yield();
+                }
+                idleWorkers--;
+                continue;
+            }
+
+            long long localNodes = 0;
+            search(id, node.depth, node.loads, node.machineOf, localNodes);
+            nodes += localNodes % 4096;
+            outstanding--;
+        }
+    }
+
+    bool hasWork() {
+        for (WorkerQueue& queue : queues) {
+            lock_guard<mutex> guard(queue.lock);
+            if (!queue.nodes.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void recordSolution(const vector<int>& loads, const vector<int>& machineOf) {
+        int Cmax = *max_element(loads.begin(), loads.end());
+        lock_guard<mutex> guard(bestMutex);
+        if (Cmax < bestCmax.load()) {
+            bestCmax = Cmax;
+            bestMachineOf = machineOf;
+            solutionFound = true;
+            if (Cmax <= lowerBound) {
+                stop = true;
+            }
+        }
+    }
+
+    void search(int id, int depth, vector<int>& loads, vector<int>& machineOf, long long& localNodes) {
+        if (stop.load(memory_order_relaxed)) {
+            return;
+        }
+        if (++localNodes % 4096 == 0 && nodes.fetch_add(4096) + 4096 > nodeLimit) {
+            limitReached = true;
+            stop = true;
+            return;
+        }
+
+        int numJobs = static_cast<int>(durations.size());
+        if (depth == numJobs) {
+            recordSolution(loads, machineOf);
+            return;
+        }
+
+        // Every remaining job has to fit below the incumbent somewhere.
+        int target = bestCmax.load(memory_order_relaxed) - 1;
+        long long capacity = 0;
+        for (int load : loads) {
+            capacity += max(0, target - load);
+        }
+        if (capacity < remainingWork[depth]) {
+            return;
+        }
+
+        vector<int> order(numMachines);
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&](int a, int b) { return loads[a] < loads[b]; });
+
+        int duration = durations[depth];
+        bool share = numThreads > 1 && numJobs - depth > kMinSharedJobs && idleWorkers.load(memory_order_relaxed) > 0;
+        bool first = true;
+
+        for (int k = 0; k < numMachines; ++k) {
+            int machine = order[k];
+            if (k > 0 && loads[machine] == loads[order[k - 1]]) {
+                continue;
+            }
+            if (loads[machine] + duration >= bestCmax.load(memory_order_relaxed)) {
+                break;
+            }
+
+            loads[machine] += duration;
+            machineOf[depth] = machine;
+            if (share && !first) {
+                outstanding++;
+                lock_guard<mutex> guard(queues[id].lock);
+                queues[id].nodes.push_back({depth + 1, loads, machineOf});
+            } else {
+                search(id, depth + 1, loads, machineOf, localNodes);
+            }
+            loads[machine] -= duration;
+            first = false;
+        }
+    }
+
+    const vector<int>& durations;
+    int numMachines;
+    long long lowerBound;
+    long long nodeLimit;
+    int numThreads;
+    vector<WorkerQueue> queues;
+    vector<long long> remainingWork;
+
+    atomic<int> bestCmax;
+    mutex bestMutex;
+    vector<int> bestMachineOf;
+
+    atomic<long long> nodes;
+    atomic<long long> outstanding;
+    atomic<int> idleWorkers;
+    atomic<bool> stop;
+    atomic<bool> limitReached;
+    bool solutionFound;
+};
+
+ExactResult solveExact(const vector<int>& tasks, int numMachines, int incumbentCmax,
+                       const vector<int>& incumbentAssignments, int numThreads, long long nodeLimit) {
+    long long totalLoad = 0;
+    for (int duration : tasks) {
+        totalLoad += duration;
+    }
+    if (numMachines == 2 && totalLoad <= kMaxPartitionLoad) {
+        ExactResult result = {0, true, 0, {}};
+        result.Cmax = solveTwoMachines(tasks, result.taskAssignments);
+        return result;
+    }
+
+    vector<int> jobOrder(tasks.size());
+    iota(jobOrder.begin(), jobOrder.end(), 0);
+    stable_sort(jobOrder.begin(), jobOrder.end(), [&](int a, int b) { return tasks[a] > tasks[b]; });
+
+    vector<int> durations(tasks.size());
+    for (size_t j = 0; j < jobOrder.size(); ++j) {
+        durations[j] = tasks[jobOrder[j]];
+    }
+
+    long long lowerBound = makespanLowerBound(tasks, numMachines);
+
+    ParallelSearch sequential(durations, numMachines, lowerBound, incumbentCmax,
+                              min(nodeLimit, kSequentialNodeBudget), 1);
+    sequential.run();
+
+    ExactResult result = {sequential.Cmax(), sequential.proven(), sequential.nodeCount(), {}};
+    vector<int> machineOf = sequential.machineOf();
+    bool found = sequential.found();
+
+    if (!result.proven && numThreads > 1 && nodeLimit > kSequentialNodeBudget) {
+        ParallelSearch parallel(durations, numMachines, lowerBound, result.Cmax - 1,
+                                nodeLimit - result.nodes, numThreads);
+        parallel.run();
+
+        result.nodes += parallel.nodeCount();
+        result.proven = parallel.proven();
+        if (parallel.found()) {
+            result.Cmax = parallel.Cmax();
+            machineOf = parallel.machineOf();
+            found = true;
+        }
+    }
+
+    // The node limit ran out before the search reached the incumbent, which
+    // is then the best schedule known.
+    if (!found) {
+        result.Cmax = incumbentCmax;
+        result.taskAssignments = incumbentAssignments;
+        return result;
+    }
+
+    result.taskAssignments.assign(tasks.size(), 0);
+    for (size_t j = 0; j < jobOrder.size(); ++j) {
+        result.taskAssignments[jobOrder[j]] = machineOf[j] + 1;
+    }
+    return result;
+}
+
+// Best of the LPT, SPT, mixed and percentage-split list schedules. Writes its
+// 1-based machine of each input task to bestAssignments and returns its Cmax.
+static int bestHeuristicSchedule(const vector<int>& tasks, int numMachines, vector<int>& bestAssignments) {
+    vector<int> positions;
+    vector<int> orderedTasks;
+    vector<int> taskAssignments(tasks.size());
+    SplitSweep sweep;
+    sweep.reset(tasks);
+
+    int best = INT_MAX;
+    auto keepIfBetter = [&]() {
+        int Cmax = listSchedule(orderedTasks, numMachines, taskAssignments);
+        if (Cmax < best) {
+            best = Cmax;
+            for (size_t i = 0; i < positions.size(); ++i) {
+                bestAssignments[positions[i]] = taskAssignments[i];
+            }
+        }
+    };
+
+    int numJobs = static_cast<int>(tasks.size());
+    bestAssignments.assign(tasks.size(), 0);
+    vector<int> splits = {0, numJobs, numJobs / 2};
+    for (int sptPercentage = 5; sptPercentage <= 95; sptPercentage += 5) {
+        splits.push_back(static_cast<int>(round((sptPercentage / 100.0) * numJobs)));
+    }
+    for (int split : splits) {
+        sweep.orderSplit(split, orderedTasks);
+        sweep.splitPositions(split, positions);
+        keepIfBetter();
+    }
+
+    // Mixed LPT-SPT: descending first half, ascending second half.
+    positions.resize(tasks.size());
+    iota(positions.begin(), positions.end(), 0);
+    stable_sort(positions.begin(), positions.begin() + numJobs / 2,
+                [&](int a, int b) { return tasks[a] > tasks[b]; });
+    stable_sort(positions.begin() + numJobs / 2, positions.end(),
+                [&](int a, int b) { return tasks[a] < tasks[b]; });
+    for (int i = 0; i < numJobs; ++i) {
+        orderedTasks[i] = tasks[positions[i]];
+    }
+    keepIfBetter();
+
+    return best;
+}
+
+void runExact() {
+    ifstream inputFile("main_directory/input.txt");
+    ofstream outputFile("main_directory/output/exact_output.txt");
+    ofstream assignmentsFile("main_directory/output/exact_assignments.txt");
+
+    if (!inputFile || !outputFile || !assignmentsFile) {
+        cerr << "Error opening files for Exact." << endl;
+        return;
+    }
+
+    int numThreads = max(1u, thread::hardware_concurrency());
+
+    skipInputHeader(inputFile);
+    Instance instance;
+    ScheduleEvaluator evaluator;
+    vector<int> incumbentAssignments;
+    vector<int> jobOrder;
+    vector<int> listAssignments;
+    while (readInstance(inputFile, instance)) {
+        auto start = chrono::high_resolution_clock::now();
+
+        int incumbentCmax = bestHeuristicSchedule(instance.tasks, instance.numMachines, incumbentAssignments);
+        ExactResult result = solveExact(instance.tasks, instance.numMachines, incumbentCmax, incumbentAssignments,
+                                        numThreads, kExactNodeLimit);
+
+        auto end = chrono::high_resolution_clock::now();
+        double timeTaken = chrono::duration_cast<chrono::nanoseconds>(end - start).count() / 1e9;
+
+        LPTOrder().order(instance.tasks, jobOrder);
+        listOrderAssignments(jobOrder, result.taskAssignments, listAssignments);
+        outputFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber << " "
+                   << instance.instanceNumber << " " << result.Cmax << " " << fixed << setprecision(9) << timeTaken
+                   << " " << (result.proven ? 1 : 0) << " "
+                   << evaluator.evaluate(instance, jobOrder, listAssignments) << endl << endl;
+
+        assignmentsFile << instance.tasks.size() << " " << instance.numMachines << " " << instance.classNumber
+                        << " " << instance.instanceNumber << endl;
+        for (int assignment : listAssignments) {
+            assignmentsFile << assignment << " ";
+        }
+        assignmentsFile << endl << endl;
+    }
+
+    inputFile.close();
+    outputFile.close();
+    assignmentsFile.close();
+}
@@ -0,0 +1,29 @@
+#ifndef EXACT_SCRIPT_H
+#define EXACT_SCRIPT_H
+
+#include <vector>
+
+struct ExactResult {
+    int Cmax;
+    bool proven;
+    long long nodes;
+    std::vector<int> taskAssignments;
+};
+
+// Branch and bound for P||Cmax. Jobs are placed longest first; machines with
+// equal loads are interchangeable, so only one of them is tried per node. A
+// node is cut when the free capacity below the incumbent cannot hold the
+// remaining work. Only schedules with Cmax at most incumbentCmax (e.g. the
+// best heuristic, whose 1-based machine of each input task is
+// incumbentAssignments) are searched for. A single thread tries first;
+// instances it cannot close quickly are shared between numThreads workers by
+// work stealing. The search stops at nodeLimit nodes, in which case proven is
+// false, and the incumbent is returned if no schedule reaching it was found.
+// taskAssignments holds the 1-based machine of each input task.
+// Two-machine instances go straight to the subset-sum solver instead.
+ExactResult solveExact(const std::vector<int>& tasks, int numMachines, int incumbentCmax,
+                       const std::vector<int>& incumbentAssignments, int numThreads, long long nodeLimit);
+
+void runExact();
+
+#endif
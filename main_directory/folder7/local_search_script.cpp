@@ -0,0 +1,11 @@
+#include "local_search_script.h"
+#include "../common/list_scheduler.h"
+using namespace std;
+
+const double kLocalSearchTimeBudget = 0.01;
+
+void runLPTLocalSearch() {
+    runOrderingRule(LPTOrder(), LocalSearchSelect{kLocalSearchTimeBudget}, "LPT+LS", "main_directory/input.txt",
+                    "main_directory/output/lpt_ls_output.txt",
+                    "main_directory/output/lpt_ls_assignments.txt");
+}
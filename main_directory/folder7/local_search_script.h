@@ -0,0 +1,7 @@
+#ifndef LOCAL_SEARCH_SCRIPT_H
+#define LOCAL_SEARCH_SCRIPT_H
+
+// LPT followed by the local-search improvement phase.
+void runLPTLocalSearch();
+
+#endif
@@ -0,0 +1,9 @@
+#include "multifit_script.h"
+#include "../common/list_scheduler.h"
+using namespace std;
+
+void runMultifit() {
+    runOrderingRule(LPTOrder(), MultifitSelect(), "MULTIFIT", "main_directory/input.txt",
+                    "main_directory/output/multifit_output.txt",
+                    "main_directory/output/multifit_assignments.txt");
+}
@@ -0,0 +1,6 @@
+#ifndef MULTIFIT_SCRIPT_H
+#define MULTIFIT_SCRIPT_H
+
+void runMultifit();
+
+#endif
@@ -0,0 +1,9 @@
+#include "ldm_script.h"
+#include "../common/list_scheduler.h"
+using namespace std;
+
+void runLDM() {
+    runOrderingRule(LPTOrder(), DifferencingSelect(), "LDM", "main_directory/input.txt",
+                    "main_directory/output/ldm_output.txt",
+                    "main_directory/output/ldm_assignments.txt");
+}
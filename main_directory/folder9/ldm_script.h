@@ -0,0 +1,6 @@
+#ifndef LDM_SCRIPT_H
+#define LDM_SCRIPT_H
+
+void runLDM();
+
+#endif
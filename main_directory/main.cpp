@@ -3,6 +3,23 @@
 #include "folder3/mixed_lpt_spt_script.h"
 #include "folder4/mixed_spt_lpt_script.h"
 #include "folder5/percentage_spt_lpt_script.h"
+#include "folder6/exact_script.h"
+#include "folder7/local_search_script.h"
+#include "folder8/multifit_script.h"
+#include "folder9/ldm_script.h"
+#include "folder10/annealing_script.h"
+#include "folder11/genetic_script.h"
+#include "folder12/ptas_script.h"
+#include "folder13/uniform_script.h"
+#include "folder14/unrelated_script.h"
+#include "folder15/precedence_script.h"
+#include "folder16/eligibility_script.h"
+#include "folder17/dynamic_script.h"
+#include "folder18/online_script.h"
+#include "folder19/breakpoint_script.h"
+#include "common/instance_io.h"
+#include "common/makespan_bounds.h"
+#include "common/schedule_metrics.h"
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -12,11 +29,82 @@
 #include <algorithm>
 #include <filesystem>
 #include <random>
+#include <cmath>
+#include <iterator>
+#include <cstdlib>
+#include <numeric>
 using namespace std;
 
 namespace fs = std::filesystem;
 
-void generateMappedInputFile(const string &fileName, int instancesPerClass) {
+// Machine sets drawn for each job by the "eligible" block: a prefix of the
+// machines (nested sets), a contiguous range, or each machine independently
+// with probability one half.
+enum class EligibilityPattern { None, Nested, Interval, Random };
+
+static vector<int> drawEligibleMachines(EligibilityPattern pattern, int m, mt19937 &gen) {
+    vector<int> machines;
+    if (pattern == EligibilityPattern::Nested) {
+        int count = uniform_int_distribution<>(1, m)(gen);
+        for (int machine = 0; machine < count; ++machine) machines.push_back(machine);
+    } else if (pattern == EligibilityPattern::Interval) {
+        int first = uniform_int_distribution<>(0, m - 1)(gen);
+        int last = uniform_int_distribution<>(first, m - 1)(gen);
+        for (int machine = first; machine <= last; ++machine) machines.push_back(machine);
+    } else {
+        bernoulli_distribution eligible(0.5);
+        for (int machine = 0; machine < m; ++machine) {
+            if (eligible(gen)) machines.push_back(machine);
+        }
+        if (machines.empty()) machines.push_back(uniform_int_distribution<>(0, m - 1)(gen));
+    }
+    return machines;
+}
+
+// Precedence edges of a layered random DAG: the jobs are dealt in random
+// order into two or more layers, and every job outside the first layer gets
+// each job of the layer before it as a predecessor with probability one half,
+// at least one of them always.
+static vector<pair<int, int>> drawLayeredDag(int n, mt19937 &gen) {
+    vector<int> jobs(n);
+    iota(jobs.begin(), jobs.end(), 0);
+    shuffle(jobs.begin(), jobs.end(), gen);
+    int layers = uniform_int_distribution<>(2, max(2, n / 3))(gen);
+
+    vector<pair<int, int>> edges;
+    bernoulli_distribution linked(0.5);
+    int previousBegin = 0, previousEnd = 0;
+    for (int layer = 0; layer < layers; ++layer) {
+        int begin = layer * n / layers, end = (layer + 1) * n / layers;
+        if (layer > 0) {
+            for (int i = begin; i < end; ++i) {
+                bool hasPredecessor = false;
+                for (int p = previousBegin; p < previousEnd; ++p) {
+                    if (linked(gen)) {
+                        edges.push_back({jobs[p], jobs[i]});
+                        hasPredecessor = true;
+                    }
+                }
+                if (!hasPredecessor) {
+                    int p = uniform_int_distribution<>(previousBegin, previousEnd - 1)(gen);
+                    edges.push_back({jobs[p], jobs[i]});
+                }
+            }
+        }
+        previousBegin = begin;
+        previousEnd = end;
+    }
+    return edges;
+}
+
+// Every instance carries a "weights" block of job weights between 1 and 10.
+// With unrelated set, it is followed by a "times" block: one row per job with
+// a processing time on each machine, drawn between half and one and a half
+// times the job's duration. Any eligibility pattern other than None adds an
+// "eligible" block with one machine list per job, and precedence adds an
+// "edges" block with the arcs of a layered random DAG.
+void generateMappedInputFile(const string &fileName, int instancesPerClass, bool unrelated = false,
+                             EligibilityPattern eligibility = EligibilityPattern::None, bool precedence = false) {
     ofstream inputFile(fileName);
     if (!inputFile) {
         cerr << "Failed to create input file: " << fileName << endl;
@@ -53,11 +141,49 @@ void generateMappedInputFile(const string &fileName, int instancesPerClass) {
                         totalInstances++;
                         outputBuffer << n << " " << m << " " << classNumber << " " << instance << endl;
 
+                        vector<int> durations(n);
                         for (int i = 0; i < n; ++i) {
-                            outputBuffer << dis(gen);
+                            durations[i] = dis(gen);
+                            outputBuffer << durations[i];
                             if (i != n - 1) outputBuffer << " ";
                         }
-                        outputBuffer << endl << endl;
+                        outputBuffer << endl;
+
+                        uniform_int_distribution<> weight(1, 10);
+                        outputBuffer << "weights";
+                        for (int i = 0; i < n; ++i) {
+                            outputBuffer << " " << weight(gen);
+                        }
+                        outputBuffer << endl;
+
+                        if (unrelated) {
+                            uniform_real_distribution<> factor(0.5, 1.5);
+                            outputBuffer << "times" << endl;
+                            for (int duration : durations) {
+                                for (int machine = 0; machine < m; ++machine) {
+                                    outputBuffer << max(1, static_cast<int>(round(duration * factor(gen))));
+                                    if (machine != m - 1) outputBuffer << " ";
+                                }
+                                outputBuffer << endl;
+                            }
+                        }
+                        if (eligibility != EligibilityPattern::None) {
+                            outputBuffer << "eligible" << endl;
+                            for (int i = 0; i < n; ++i) {
+                                vector<int> machines = drawEligibleMachines(eligibility, m, gen);
+                                outputBuffer << machines.size();
+                                for (int machine : machines) outputBuffer << " " << machine;
+                                outputBuffer << endl;
+                            }
+                        }
+                        if (precedence) {
+                            vector<pair<int, int>> edges = drawLayeredDag(n, gen);
+                            outputBuffer << "edges " << edges.size() << endl;
+                            for (const auto &edge : edges) {
+                                outputBuffer << edge.first << " " << edge.second << endl;
+                            }
+                        }
+                        outputBuffer << endl;
                     }
                 }
             }
@@ -69,16 +195,26 @@ void generateMappedInputFile(const string &fileName, int instancesPerClass) {
     inputFile.close();
 }
 
+// Objective columns that follow Cmax and the time in the summary files.
+const vector<string> kObjectiveNames = {"Cmin", "L2", "SumC", "SumWC"};
+
 void runAlgorithmsAndGenerateCSV() {
     vector<string> algorithmFiles = {
         "main_directory/output/lpt_output.txt",
         "main_directory/output/spt_output.txt",
         "main_directory/output/mixed_lpt_spt_output.txt",
-        "main_directory/output/mixed_spt_lpt_output.txt"
+        "main_directory/output/mixed_spt_lpt_output.txt",
+        "main_directory/output/lpt_ls_output.txt",
+        "main_directory/output/multifit_output.txt",
+        "main_directory/output/ldm_output.txt",
+        "main_directory/output/annealing_output.txt",
+        "main_directory/output/genetic_output.txt",
+        "main_directory/output/ptas_output.txt"
     };
 
-    vector<string> algorithmNames = {"LPT", "SPT", "50% LPT-SPT", "50% SPT-LPT"};
+    vector<string> algorithmNames = {"LPT", "SPT", "50% LPT-SPT", "50% SPT-LPT", "LPT+LS", "MULTIFIT", "LDM", "PT-SA", "GA", "PTAS"};
     map<pair<int, int>, vector<int>> results;
+    map<pair<int, int>, vector<vector<string>>> objectives;
     vector<int> cumulativeCmax(algorithmFiles.size(), 0);
 
     ifstream inputFile;
@@ -100,11 +236,51 @@ void runAlgorithmsAndGenerateCSV() {
             if (iss >> numJobs >> numMachines >> classNumber >> instanceNumber >> Cmax >> timeTaken) {
                 results[{numJobs * 100 + numMachines, classNumber * 10 + instanceNumber}].push_back(Cmax);
                 cumulativeCmax[i] += Cmax;
+
+                // The last four fields, when present, are Cmin l2 sumC sumWC.
+                vector<string> fields{istream_iterator<string>(iss), istream_iterator<string>()};
+                if (fields.size() >= kObjectiveNames.size()) {
+                    fields.erase(fields.begin(), fields.end() - kObjectiveNames.size());
+                } else {
+                    fields.assign(kObjectiveNames.size(), "");
+                }
+                objectives[{numJobs * 100 + numMachines, classNumber * 10 + instanceNumber}].push_back(fields);
             }
         }
         inputFile.close();
     }
 
+    map<pair<int, int>, long long> lowerBounds;
+    ifstream instancesFile("main_directory/input.txt");
+    if (instancesFile.is_open()) {
+        skipInputHeader(instancesFile);
+        Instance instance;
+        while (readInstance(instancesFile, instance)) {
+            lowerBounds[{instance.numJobs * 100 + instance.numMachines, instance.classNumber * 10 + instance.instanceNumber}] =
+                makespanLowerBound(instance.tasks, instance.numMachines);
+        }
+        instancesFile.close();
+    } else {
+        cerr << "Error opening input file for lower bounds." << endl;
+    }
+
+    // A proven optimum is the tightest bound there is.
+    ifstream exactFile("main_directory/output/exact_output.txt");
+    if (exactFile.is_open()) {
+        string line;
+        while (getline(exactFile, line)) {
+            istringstream iss(line);
+            int numJobs, numMachines, classNumber, instanceNumber, Cmax, proven;
+            double timeTaken;
+
+            if (iss >> numJobs >> numMachines >> classNumber >> instanceNumber >> Cmax >> timeTaken >> proven && proven) {
+                long long &lowerBound = lowerBounds[{numJobs * 100 + numMachines, classNumber * 10 + instanceNumber}];
+                lowerBound = max(lowerBound, static_cast<long long>(Cmax));
+            }
+        }
+        exactFile.close();
+    }
+
     string outputDirectory = "main_directory/output";
     string csvFilePath = outputDirectory + "/algorithm_comparison_results.csv";
 
@@ -126,10 +302,21 @@ void runAlgorithmsAndGenerateCSV() {
     for (const string &algo : algorithmNames) {
         csvFile << ",Gap " << algo;
     }
+    csvFile << ",,LB";
+    for (const string &algo : algorithmNames) {
+        csvFile << ",Gap to LB " << algo;
+    }
     csvFile << ",Best Algo ";
+    for (const string &objective : kObjectiveNames) {
+        csvFile << ",";
+        for (const string &algo : algorithmNames) {
+            csvFile << "," << objective << " " << algo;
+        }
+    }
     csvFile << endl;
 
     vector<int> zeroCounts(algorithmNames.size(), 0);
+    vector<int> atBoundCounts(algorithmNames.size(), 0);
 
     for (const auto &entry : results) {
         const auto &instance = entry.first;
@@ -157,13 +344,41 @@ void runAlgorithmsAndGenerateCSV() {
             }
         }
 
+        // A heuristic that reaches the lower bound is provably optimal.
+        auto bound = lowerBounds.find(instance);
+        long long lowerBound = bound != lowerBounds.end() ? bound->second : 0;
+        csvFile << ",," << lowerBound;
+        for (size_t i = 0; i < cmaxValues.size(); ++i) {
+            csvFile << ",";
+            if (lowerBound > 0) {
+                double gapToBound = static_cast<double>(cmaxValues[i] - lowerBound) / lowerBound;
+                csvFile << fixed << setprecision(5) << gapToBound;
+                if (cmaxValues[i] <= lowerBound) {
+                    atBoundCounts[i]++;
+                }
+            }
+        }
+
+        csvFile << ",";
+        const vector<vector<string>> &objectiveValues = objectives[instance];
+        for (size_t k = 0; k < kObjectiveNames.size(); ++k) {
+            csvFile << ",";
+            for (const vector<string> &values : objectiveValues) {
+                csvFile << "," << values[k];
+            }
+        }
+
         csvFile << endl;
     }
 
-    csvFile << "0 Count,,,,,,";
+    csvFile << "0 Count" << string(algorithmNames.size() + 2, ',');
     for (int count : zeroCounts) {
         csvFile << "," << count;
     }
+    csvFile << ",,";
+    for (int count : atBoundCounts) {
+        csvFile << "," << count;
+    }
 
     int bestAlgorithmIndex = max_element(zeroCounts.begin(), zeroCounts.end()) - zeroCounts.begin();
     string bestAlgorithm = algorithmNames[bestAlgorithmIndex];
@@ -178,6 +393,11 @@ void runAlgorithmsAndGenerateCSV() {
         cout << algorithmNames[i] << ": " << cumulativeCmax[i] << endl;
     }
 
+    cout << "Instances solved to the lower bound:" << endl;
+    for (size_t i = 0; i < algorithmNames.size(); ++i) {
+        cout << algorithmNames[i] << ": " << atBoundCounts[i] << " of " << results.size() << endl;
+    }
+
     string percentageFile = "main_directory/output/percentage_output/best_percentage.txt";
     ifstream percentageInput(percentageFile);
     if (percentageInput.is_open()) {
@@ -198,17 +418,71 @@ void runAlgorithmsAndGenerateCSV() {
     cout << "Best Algorithm: " << bestAlgorithm << endl;
 }
 
-int main() {
+// "main stream <machines> [graham|albers] [report interval] [file]" schedules
+// the durations of file (stdin by default) online instead of running the
+// study.
+static int runStreamingMode(int argc, char *argv[]) {
+    if (argc < 3) {
+        cerr << "Usage: " << argv[0] << " stream <machines> [graham|albers] [report interval] [file]" << endl;
+        return 1;
+    }
+    int numMachines = atoi(argv[2]);
+    OnlineRule rule = argc > 3 && string(argv[3]) == "albers" ? OnlineRule::Albers : OnlineRule::Graham;
+    long long reportInterval = argc > 4 ? atoll(argv[4]) : 10000000;
+    if (numMachines <= 0 || reportInterval <= 0) {
+        cerr << "Machine count and report interval must be positive." << endl;
+        return 1;
+    }
+
+    if (argc > 5) {
+        ifstream jobFile(argv[5], ios::binary);
+        if (!jobFile) {
+            cerr << "Failed to open job stream: " << argv[5] << endl;
+            return 1;
+        }
+        runStreaming(jobFile, numMachines, rule, reportInterval);
+    } else {
+        ios::sync_with_stdio(false);
+        runStreaming(cin, numMachines, rule, reportInterval);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "stream") {
+        return runStreamingMode(argc, argv);
+    }
+
     string fileName = "main_directory/input.txt";
     int instancesPerClass = 10;
 
     generateMappedInputFile(fileName, instancesPerClass);
+    generateMappedInputFile("main_directory/unrelated_input.txt", instancesPerClass, true);
+    generateMappedInputFile("main_directory/eligibility_nested_input.txt", instancesPerClass, false, EligibilityPattern::Nested);
+    generateMappedInputFile("main_directory/eligibility_interval_input.txt", instancesPerClass, false, EligibilityPattern::Interval);
+    generateMappedInputFile("main_directory/eligibility_random_input.txt", instancesPerClass, false, EligibilityPattern::Random);
+    generateMappedInputFile("main_directory/precedence_input.txt", instancesPerClass, false, EligibilityPattern::None, true);
 
     runLPT();
     runSPT();
     runMixedLPTSPT();
     runMixedSPTLPT();
+    runLPTLocalSearch();
+    runMultifit();
+    runLDM();
+    runAnnealing();
+    runGenetic();
+    runPTAS();
     runPercentageSPT_LPT();
+    runExhaustiveSplitSPT_LPT();
+    runBreakpointSearch();
+    runExact();
+    runUniformMachines();
+    runUnrelatedMachines();
+    runPrecedence();
+    runEligibility();
+    runDynamicSchedule();
+    runOnlineSchedule();
 
     runAlgorithmsAndGenerateCSV();
 